@@ -3,7 +3,9 @@
 #include "barretenberg/common/map.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/dsl/acir_format/acir_format.hpp"
+#include "barretenberg/dsl/acir_proofs/circuit_template.hpp"
 #include "barretenberg/dsl/acir_proofs/honk_contract.hpp"
+#include "barretenberg/dsl/acir_proofs/honk_key_cache.hpp"
 #include "barretenberg/honk/proof_system/types/proof.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/serialize.hpp"
 #include "barretenberg/plonk_honk_shared/types/aggregation_object_type.hpp"
@@ -31,9 +33,12 @@
 #include <barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp>
 #include <barretenberg/dsl/acir_proofs/acir_composer.hpp>
 #include <barretenberg/srs/global_crs.hpp>
+#include <cctype>
 #include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -47,6 +52,10 @@ std::string getHomeDir()
 }
 
 std::string CRS_PATH = getHomeDir() + "/.bb-crs";
+// Directory of the Honk proving/verification key cache (see acir_proofs::HonkKeyCache); caching is disabled if empty
+std::string KEY_CACHE_PATH;
+// Memory budget of the prover polynomials of Honk proofs (see ProverMemoryBudget), unlimited if unset
+std::optional<size_t> MEMORY_BUDGET;
 
 const std::filesystem::path current_path = std::filesystem::current_path();
 const auto current_dir = current_path.filename().string();
@@ -226,6 +235,9 @@ template <IsUltraFlavor Flavor> bool proveAndVerifyHonk(const std::string& bytec
 
 /**
  * @brief Constructs and verifies multiple Honk proofs for an ACIR-generated program.
+ * @details With an Ultra circuit builder, every function of the program is proven through a CircuitTemplate, so the
+ * precomputed polynomials and the verification key of a function called several times are only computed on its first
+ * call.
  *
  * @tparam Flavor
  * @param bytecodePath Path to serialized acir program data. An ACIR program contains a list of circuits.
@@ -241,6 +253,39 @@ bool proveAndVerifyHonkProgram(const std::string& bytecodePath, const std::strin
     }
     auto program_stack = acir_format::get_acir_program_stack(bytecodePath, witnessPath, honk_recursion);
 
+    if constexpr (std::same_as<typename Flavor::CircuitBuilder, UltraCircuitBuilder>) {
+        using Prover = UltraProver_<Flavor>;
+        using Verifier = UltraVerifier_<Flavor>;
+        using VerificationKey = Flavor::VerificationKey;
+
+        // The template and the verification key of each function, by function index
+        std::map<uint32_t, acir_proofs::CircuitTemplate<Flavor>> templates;
+        std::map<uint32_t, std::shared_ptr<VerificationKey>> verification_keys;
+        while (!program_stack.empty()) {
+            const uint32_t function_index = program_stack.witness_stack.back().first;
+            auto stack_item = program_stack.back();
+            auto& circuit_template =
+                templates.try_emplace(function_index, std::move(stack_item.constraints), honk_recursion).first->second;
+
+            auto builder = circuit_template.create_circuit(stack_item.witness);
+            auto num_extra_gates = builder.get_num_gates_added_to_ensure_nonzero_polynomials();
+            init_bn254_crs(builder.get_circuit_subgroup_size(builder.get_total_circuit_size() + num_extra_gates));
+
+            Prover prover{ circuit_template.create_prover_instance(builder) };
+            auto& verification_key = verification_keys[function_index];
+            if (!verification_key) {
+                verification_key = std::make_shared<VerificationKey>(prover.instance->proving_key);
+            }
+            auto proof = prover.construct_proof();
+            Verifier verifier{ verification_key };
+            if (!verifier.verify_proof(proof)) {
+                return false;
+            }
+            program_stack.pop_back();
+        }
+        return true;
+    }
+
     while (!program_stack.empty()) {
         auto stack_item = program_stack.back();
 
@@ -1031,6 +1076,48 @@ bool avm_verify(const std::filesystem::path& proof_path, const std::filesystem::
 }
 #endif
 
+/**
+ * @brief Give a prover the memory budget set with `--memory-budget <size>`, if any
+ */
+template <IsUltraFlavor Flavor> UltraProver_<Flavor> with_memory_budget(UltraProver_<Flavor>&& prover)
+{
+    if (MEMORY_BUDGET) {
+        prover.memory_budget = std::make_shared<ProverMemoryBudget<Flavor>>(*MEMORY_BUDGET);
+    }
+    return std::move(prover);
+}
+
+/**
+ * @brief Construct an Ultra Honk prover for a circuit, reusing cached precomputed polynomials when possible
+ * @details If a key cache is configured (`--key_cache <dir>`), the witness-independent part of the proving key is
+ * loaded from the entry for this bytecode and only the witness polynomials are computed from the circuit. On a miss the
+ * precomputed polynomials and the verification key are computed as usual and written to the cache.
+ */
+template <IsUltraFlavor Flavor>
+UltraProver_<Flavor> construct_prover(typename Flavor::CircuitBuilder& builder,
+                                      const std::vector<uint8_t>& bytecode,
+                                      bool honk_recursion)
+{
+    using Prover = UltraProver_<Flavor>;
+    using VerificationKey = Flavor::VerificationKey;
+
+    if (KEY_CACHE_PATH.empty()) {
+        return with_memory_budget(Prover{ builder });
+    }
+
+    acir_proofs::HonkKeyCache<Flavor> cache(KEY_CACHE_PATH, bytecode, honk_recursion);
+    if (auto proving_key = cache.load_proving_key()) {
+        vinfo("using cached proving key: ", cache.proving_key_path());
+        auto instance = std::make_shared<ProverInstance_<Flavor>>(builder, std::move(*proving_key));
+        return with_memory_budget(Prover{ instance });
+    }
+
+    Prover prover{ builder };
+    cache.store(prover.instance->proving_key, VerificationKey(prover.instance->proving_key));
+    vinfo("proving key written to cache: ", cache.proving_key_path());
+    return with_memory_budget(std::move(prover));
+}
+
 /**
  * @brief Create a Honk a prover from program bytecode and an optional witness
  *
@@ -1043,13 +1130,13 @@ template <typename Flavor>
 UltraProver_<Flavor> compute_valid_prover(const std::string& bytecodePath, const std::string& witnessPath)
 {
     using Builder = Flavor::CircuitBuilder;
-    using Prover = UltraProver_<Flavor>;
 
     bool honk_recursion = false;
     if constexpr (IsAnyOf<Flavor, UltraFlavor, UltraKeccakFlavor>) {
         honk_recursion = true;
     }
-    auto constraint_system = get_constraint_system(bytecodePath, honk_recursion);
+    auto bytecode = get_bytecode(bytecodePath);
+    auto constraint_system = acir_format::circuit_buf_to_acir_format(bytecode, honk_recursion);
     acir_format::WitnessVector witness = {};
     if (!witnessPath.empty()) {
         witness = get_witness(witnessPath);
@@ -1061,8 +1148,7 @@ UltraProver_<Flavor> compute_valid_prover(const std::string& bytecodePath, const
     size_t srs_size = builder.get_circuit_subgroup_size(builder.get_total_circuit_size() + num_extra_gates);
     init_bn254_crs(srs_size);
 
-    Prover prover{ builder };
-    return prover;
+    return construct_prover<Flavor>(builder, bytecode, honk_recursion);
 }
 
 /**
@@ -1145,12 +1231,27 @@ template <IsUltraFlavor Flavor> void write_vk_honk(const std::string& bytecodePa
     using ProverInstance = ProverInstance_<Flavor>;
     using VerificationKey = Flavor::VerificationKey;
 
-    Prover prover = compute_valid_prover<Flavor>(bytecodePath, "");
-    ProverInstance& prover_inst = *prover.instance;
-    VerificationKey vk(
-        prover_inst.proving_key); // uses a partial form of the proving key which only has precomputed entities
+    std::shared_ptr<VerificationKey> vk;
+    std::optional<acir_proofs::HonkKeyCache<Flavor>> cache;
+    if (!KEY_CACHE_PATH.empty()) {
+        // A cache hit provides the verification key without constructing the circuit at all
+        const bool honk_recursion = IsAnyOf<Flavor, UltraFlavor, UltraKeccakFlavor>;
+        cache.emplace(KEY_CACHE_PATH, get_bytecode(bytecodePath), honk_recursion);
+        vk = cache->load_verification_key();
+    }
+    if (!vk) {
+        Prover prover = compute_valid_prover<Flavor>(bytecodePath, "");
+        if (cache) {
+            // Written by compute_valid_prover on a cache miss, recomputed if a cached entry lacks it
+            vk = cache->load_or_store_verification_key(prover.instance->proving_key);
+        } else {
+            ProverInstance& prover_inst = *prover.instance;
+            vk = std::make_shared<VerificationKey>(
+                prover_inst.proving_key); // uses a partial form of the proving key which only has precomputed entities
+        }
+    }
 
-    auto serialized_vk = to_buffer(vk);
+    auto serialized_vk = to_buffer(*vk);
     if (outputPath == "-") {
         writeRawBytesToStdout(serialized_vk);
         vinfo("vk written to stdout");
@@ -1290,7 +1391,8 @@ void prove_honk_output_all(const std::string& bytecodePath,
         honk_recursion = true;
     }
 
-    auto constraint_system = get_constraint_system(bytecodePath, honk_recursion);
+    auto bytecode = get_bytecode(bytecodePath);
+    auto constraint_system = acir_format::circuit_buf_to_acir_format(bytecode, honk_recursion);
     auto witness = get_witness(witnessPath);
 
     auto builder = acir_format::create_circuit<Builder>(constraint_system, 0, witness, honk_recursion);
@@ -1300,7 +1402,7 @@ void prove_honk_output_all(const std::string& bytecodePath,
     init_bn254_crs(srs_size);
 
     // Construct Honk proof
-    Prover prover{ builder };
+    Prover prover = construct_prover<Flavor>(builder, bytecode, honk_recursion);
     auto proof = prover.construct_proof();
 
     // We have been given a directory, we will write the proof and verification key
@@ -1310,8 +1412,12 @@ void prove_honk_output_all(const std::string& bytecodePath,
     std::string vkFieldsOutputPath = outputPath + "/vk_fields.json";
     std::string proofFieldsPath = outputPath + "/proof_fields.json";
 
-    VerificationKey vk(
-        prover.instance->proving_key); // uses a partial form of the proving key which only has precomputed entities
+    std::shared_ptr<VerificationKey> cached_vk;
+    if (!KEY_CACHE_PATH.empty()) {
+        cached_vk = acir_proofs::HonkKeyCache<Flavor>(KEY_CACHE_PATH, bytecode, honk_recursion).load_verification_key();
+    }
+    // uses a partial form of the proving key which only has precomputed entities
+    VerificationKey vk = cached_vk ? *cached_vk : VerificationKey(prover.instance->proving_key);
 
     // Write the 'binary' proof
     write_file(proofPath, to_buffer</*include_size=*/true>(proof));
@@ -1345,6 +1451,21 @@ std::string get_option(std::vector<std::string>& args, const std::string& option
     return (itr != args.end() && std::next(itr) != args.end()) ? *(std::next(itr)) : defaultValue;
 }
 
+/**
+ * @brief Parse a size in bytes with an optional K, M or G suffix (powers of 1024), e.g. "512M"
+ */
+size_t parse_memory_size(const std::string& size)
+{
+    static const std::map<std::string, size_t> shifts{ { "", 0 }, { "K", 10 }, { "M", 20 }, { "G", 30 } };
+    const auto digits = static_cast<size_t>(std::distance(
+        size.begin(), std::find_if(size.begin(), size.end(), [](unsigned char c) { return std::isdigit(c) == 0; })));
+    const auto shift = shifts.find(size.substr(digits));
+    if (digits == 0 || shift == shifts.end()) {
+        throw std::runtime_error("invalid memory size: " + size);
+    }
+    return std::stoull(size.substr(0, digits)) << shift->second;
+}
+
 int main(int argc, char* argv[])
 {
     try {
@@ -1365,6 +1486,10 @@ int main(int argc, char* argv[])
         std::string pk_path = get_option(args, "-r", "./target/pk");
         bool honk_recursion = flag_present(args, "-h");
         CRS_PATH = get_option(args, "-c", CRS_PATH);
+        KEY_CACHE_PATH = get_option(args, "--key_cache", KEY_CACHE_PATH);
+        if (const std::string memory_budget = get_option(args, "--memory-budget", ""); !memory_budget.empty()) {
+            MEMORY_BUDGET = parse_memory_size(memory_budget);
+        }
 
         // Skip CRS initialization for any command which doesn't require the CRS.
         if (command == "--version") {
@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/bb/get_bytecode.hpp"
+#include "barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace benchmark;
+
+namespace {
+
+/**
+ * @brief Read the bytecode of a program of the acir_tests suite
+ * @details The Nargo artifacts are built from the Noir test programs by the acir_tests bootstrap, as for
+ * acir_integration.test.cpp; the benchmark is skipped for a program that has not been built.
+ */
+std::vector<uint8_t> get_test_program_bytecode(State& state, const std::string& test_program_name)
+{
+    const std::string bytecode_path = "../../acir_tests/acir_tests/" + test_program_name + "/target/program.json";
+    if (!std::filesystem::exists(bytecode_path)) {
+        state.SkipWithError(("missing " + bytecode_path + ", build the acir_tests first").c_str());
+        return {};
+    }
+    return get_bytecode(bytecode_path);
+}
+
+/**
+ * @brief Decode and convert every ACIR function of a program, converting each opcode as it is read from the buffer
+ */
+void program_buf_to_acir_format(State& state, const std::string& test_program_name)
+{
+    const auto bytecode = get_test_program_bytecode(state, test_program_name);
+    if (bytecode.empty()) {
+        return;
+    }
+    for (auto _ : state) {
+        DoNotOptimize(acir_format::program_buf_to_acir_format(bytecode, /*honk_recursion=*/false));
+    }
+    state.counters["bytecode_bytes"] = static_cast<double>(bytecode.size());
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytecode.size()));
+}
+
+/**
+ * @brief The conversion as it was before the streaming reader: decode the whole `Program::Program` object graph from a
+ * copy of the buffer, then convert each of its functions
+ */
+void legacy_program_buf_to_acir_format(State& state, const std::string& test_program_name)
+{
+    const auto bytecode = get_test_program_bytecode(state, test_program_name);
+    if (bytecode.empty()) {
+        return;
+    }
+    for (auto _ : state) {
+        const auto program = Program::Program::bincodeDeserialize(bytecode);
+        std::vector<acir_format::AcirFormat> constraint_systems;
+        constraint_systems.reserve(program.functions.size());
+        for (const auto& function : program.functions) {
+            constraint_systems.emplace_back(
+                acir_format::circuit_serde_to_acir_format(function, /*honk_recursion=*/false));
+        }
+        DoNotOptimize(constraint_systems);
+    }
+    state.counters["bytecode_bytes"] = static_cast<double>(bytecode.size());
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytecode.size()));
+}
+
+} // namespace
+
+// A hash-heavy circuit, a large circuit and a program of several ACIR functions
+BENCHMARK_CAPTURE(program_buf_to_acir_format, sha256, "sha256")->Unit(kMicrosecond);
+BENCHMARK_CAPTURE(program_buf_to_acir_format, regression_4709, "regression_4709")->Unit(kMicrosecond);
+BENCHMARK_CAPTURE(program_buf_to_acir_format, fold_basic, "fold_basic")->Unit(kMicrosecond);
+BENCHMARK_CAPTURE(legacy_program_buf_to_acir_format, sha256, "sha256")->Unit(kMicrosecond);
+BENCHMARK_CAPTURE(legacy_program_buf_to_acir_format, regression_4709, "regression_4709")->Unit(kMicrosecond);
+BENCHMARK_CAPTURE(legacy_program_buf_to_acir_format, fold_basic, "fold_basic")->Unit(kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,313 @@
+/**
+ * @file avm.bench.cpp
+ * @brief Per opcode family benchmarks of the AVM: trace generation (simulation and finalization, through
+ * Execution::gen_trace) and proving, split by prover round.
+ *
+ * @details Every benchmark runs a synthetic program made of a short preamble which sets up memory, `num_ops`
+ * repetitions of the opcode under test and a final RETURN. Besides the timings, the trace generation benchmarks report
+ * the number of rows each repetition adds to the main trace and to the memory, ALU, binary, comparison and gadget
+ * sub-traces (measured against the same program with zero repetitions), as well as the trace generation time per row
+ * of the final trace.
+ */
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/vm/avm/generated/circuit_builder.hpp"
+#include "barretenberg/vm/avm/generated/composer.hpp"
+#include "barretenberg/vm/avm/trace/execution.hpp"
+#include "barretenberg/vm/avm/trace/instructions.hpp"
+
+#include <chrono>
+#include <map>
+
+using namespace benchmark;
+using namespace bb;
+using namespace bb::avm_trace;
+
+namespace {
+
+struct Corpus {
+    std::vector<Instruction> instructions;
+    std::vector<FF> calldata;
+    ExecutionHints hints;
+};
+
+using CorpusGenerator = Corpus (*)(size_t);
+
+Instruction set_u32(uint32_t val, uint32_t dst_offset)
+{
+    return Instruction(OpCode::SET, { uint8_t(0), AvmMemoryTag::U32, val, dst_offset });
+}
+
+Instruction return_empty()
+{
+    return Instruction(OpCode::RETURN, { uint8_t(0), uint32_t(0), uint32_t(0) });
+}
+
+/**
+ * @brief ALU and bitwise opcodes sharing the (indirect, tag, a_offset, b_offset, dst_offset) format, on U32 operands
+ */
+template <OpCode opcode> Corpus alu_corpus(size_t num_ops)
+{
+    Corpus corpus;
+    corpus.instructions = { set_u32(123456, 0), set_u32(654321, 1) };
+    for (size_t i = 0; i < num_ops; i++) {
+        corpus.instructions.emplace_back(
+            opcode, std::vector<Operand>{ uint8_t(0), AvmMemoryTag::U32, uint32_t(0), uint32_t(1), uint32_t(2) });
+    }
+    corpus.instructions.push_back(return_empty());
+    return corpus;
+}
+
+/**
+ * @brief MOV chain walking through 256 memory cells
+ */
+Corpus mov_corpus(size_t num_ops)
+{
+    Corpus corpus;
+    corpus.instructions = { set_u32(42, 0) };
+    for (size_t i = 0; i < num_ops; i++) {
+        auto src_offset = static_cast<uint32_t>(i % 256);
+        auto dst_offset = static_cast<uint32_t>((i + 1) % 256);
+        corpus.instructions.emplace_back(OpCode::MOV, std::vector<Operand>{ uint8_t(0), src_offset, dst_offset });
+    }
+    corpus.instructions.push_back(return_empty());
+    return corpus;
+}
+
+/**
+ * @brief CALLDATACOPY of 32 calldata elements per opcode, into 16 alternating memory regions
+ */
+Corpus calldata_copy_corpus(size_t num_ops)
+{
+    constexpr uint32_t COPY_SIZE = 32;
+    Corpus corpus;
+    corpus.calldata.resize(COPY_SIZE);
+    for (size_t i = 0; i < COPY_SIZE; i++) {
+        corpus.calldata[i] = FF(i + 1);
+    }
+    for (size_t i = 0; i < num_ops; i++) {
+        auto dst_offset = static_cast<uint32_t>(i % 16) * COPY_SIZE;
+        corpus.instructions.emplace_back(OpCode::CALLDATACOPY,
+                                         std::vector<Operand>{ uint8_t(0), uint32_t(0), COPY_SIZE, dst_offset });
+    }
+    corpus.instructions.push_back(return_empty());
+    return corpus;
+}
+
+/**
+ * @brief Chained POSEIDON2 permutations of the 4 field elements at offset 0
+ */
+Corpus poseidon2_corpus(size_t num_ops)
+{
+    Corpus corpus;
+    for (size_t i = 0; i < num_ops; i++) {
+        corpus.instructions.emplace_back(OpCode::POSEIDON2,
+                                         std::vector<Operand>{ uint8_t(0), uint32_t(0), uint32_t(0) });
+    }
+    corpus.instructions.push_back(return_empty());
+    return corpus;
+}
+
+/**
+ * @brief Chained SHA256COMPRESSION of the state at offset 0 with the message block at offset 8
+ */
+Corpus sha256_compression_corpus(size_t num_ops)
+{
+    Corpus corpus;
+    for (uint32_t i = 0; i < 24; i++) {
+        corpus.instructions.push_back(set_u32(i + 1, i));
+    }
+    for (size_t i = 0; i < num_ops; i++) {
+        corpus.instructions.emplace_back(OpCode::SHA256COMPRESSION,
+                                         std::vector<Operand>{ uint8_t(0), uint32_t(0), uint32_t(0), uint32_t(8) });
+    }
+    corpus.instructions.push_back(return_empty());
+    return corpus;
+}
+
+/**
+ * @brief Chained KECCAKF1600 permutations of the 25 lanes at offset 0
+ */
+Corpus keccakf1600_corpus(size_t num_ops)
+{
+    Corpus corpus;
+    corpus.instructions = { set_u32(25, 100) };
+    for (size_t i = 0; i < num_ops; i++) {
+        corpus.instructions.emplace_back(OpCode::KECCAKF1600,
+                                         std::vector<Operand>{ uint8_t(0), uint32_t(0), uint32_t(0), uint32_t(100) });
+    }
+    corpus.instructions.push_back(return_empty());
+    return corpus;
+}
+
+/**
+ * @brief External CALLs with 4 arguments and 2 return values, each resolved by an (empty gas) external call hint
+ * @details The memory layout is that of the AvmExecutionTests.opCallOpcodes test.
+ */
+Corpus call_corpus(size_t num_ops)
+{
+    Corpus corpus;
+    // l2_gas, da_gas, contract_address, nested_call_args (4 elements)
+    corpus.calldata = { 17, 10, 34802342, 1, 2, 3, 4 };
+    corpus.instructions = {
+        Instruction(OpCode::CALLDATACOPY, { uint8_t(0), uint32_t(0), uint32_t(7), uint32_t(0) }),
+        set_u32(0, 17),   // gas offset
+        set_u32(2, 18),   // contract address offset
+        set_u32(3, 19),   // args offset
+        set_u32(4, 20),   // args size
+        set_u32(256, 21), // ret offset
+        set_u32(258, 22), // success offset
+    };
+    std::vector<ExternalCallHint> externalcall_hints;
+    for (size_t i = 0; i < num_ops; i++) {
+        corpus.instructions.emplace_back(OpCode::CALL,
+                                         std::vector<Operand>{ uint8_t(0x3f),
+                                                               uint32_t(17),
+                                                               uint32_t(18),
+                                                               uint32_t(19),
+                                                               uint32_t(20),
+                                                               uint32_t(21),
+                                                               uint32_t(2),
+                                                               uint32_t(22),
+                                                               uint32_t(23) });
+        externalcall_hints.push_back({
+            .success = 1,
+            .return_data = { 9, 8 },
+            .l2_gas_used = 0,
+            .da_gas_used = 0,
+            .end_side_effect_counter = 0,
+        });
+    }
+    corpus.hints.with_externalcall_hints(std::move(externalcall_hints));
+    corpus.instructions.push_back(return_empty());
+    return corpus;
+}
+
+std::vector<Row> generate_trace(Corpus const& corpus)
+{
+    std::vector<FF> returndata;
+    return Execution::gen_trace(
+        corpus.instructions, returndata, corpus.calldata, Execution::getDefaultPublicInputs(), corpus.hints);
+}
+
+// Number of active rows of the main trace and of some of the sub-traces
+struct RowProfile {
+    size_t main = 0;
+    size_t mem = 0;
+    size_t alu = 0;
+    size_t binary = 0;
+    size_t cmp = 0;
+    size_t gadgets = 0;
+
+    explicit RowProfile(std::vector<Row> const& trace)
+    {
+        for (auto const& row : trace) {
+            main += static_cast<size_t>(row.main_sel_execution_row == FF(1));
+            mem += static_cast<size_t>(row.mem_sel_mem == FF(1));
+            alu += static_cast<size_t>(row.alu_sel_alu == FF(1));
+            binary += static_cast<size_t>(row.binary_sel_bin == FF(1));
+            cmp += static_cast<size_t>(row.cmp_sel_cmp == FF(1));
+            gadgets += static_cast<size_t>(row.poseidon2_sel_poseidon_perm == FF(1)) +
+                       static_cast<size_t>(row.sha256_sel_sha256_compression == FF(1)) +
+                       static_cast<size_t>(row.keccakf1600_sel_keccakf1600 == FF(1)) +
+                       static_cast<size_t>(row.pedersen_sel_pedersen == FF(1)) +
+                       static_cast<size_t>(row.slice_sel_mem_active == FF(1));
+        }
+    }
+};
+
+void gen_trace(State& state, CorpusGenerator generate_corpus) noexcept
+{
+    const auto num_ops = static_cast<size_t>(state.range(0));
+    const Corpus corpus = generate_corpus(num_ops);
+    // Rows added per opcode, relative to the same program without any repetition of the opcode
+    const RowProfile baseline(generate_trace(generate_corpus(0)));
+    const RowProfile profile(generate_trace(corpus));
+
+    size_t num_rows = 0;
+    double total_ns = 0;
+    for (auto _ : state) {
+        auto start = std::chrono::steady_clock::now();
+        auto trace = generate_trace(corpus);
+        total_ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        num_rows = trace.size();
+        DoNotOptimize(trace);
+    }
+
+    const auto per_op = [&](size_t rows, size_t baseline_rows) {
+        return static_cast<double>(rows - baseline_rows) / static_cast<double>(num_ops);
+    };
+    state.counters["trace_rows"] = static_cast<double>(num_rows);
+    state.counters["ns_per_row"] = total_ns / static_cast<double>(state.iterations() * num_rows);
+    state.counters["main_rows_per_op"] = per_op(profile.main, baseline.main);
+    state.counters["mem_rows_per_op"] = per_op(profile.mem, baseline.mem);
+    state.counters["alu_rows_per_op"] = per_op(profile.alu, baseline.alu);
+    state.counters["bin_rows_per_op"] = per_op(profile.binary, baseline.binary);
+    state.counters["cmp_rows_per_op"] = per_op(profile.cmp, baseline.cmp);
+    state.counters["gadget_rows_per_op"] = per_op(profile.gadgets, baseline.gadgets);
+}
+
+/**
+ * @brief Prove the trace of a corpus and report the time spent in each prover round (in ms, averaged over iterations)
+ * @details Trace generation and the construction of the proving key happen outside of the measured time.
+ */
+void prove(State& state, CorpusGenerator generate_corpus) noexcept
+{
+    srs::init_crs_factory("../srs_db/ignition");
+    const Corpus corpus = generate_corpus(static_cast<size_t>(state.range(0)));
+
+    std::map<std::string, double> round_ms;
+    size_t circuit_size = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        AvmCircuitBuilder circuit_builder;
+        circuit_builder.set_trace(generate_trace(corpus));
+        circuit_size = circuit_builder.get_circuit_subgroup_size();
+        AvmComposer composer;
+        auto prover = composer.create_prover(circuit_builder);
+        circuit_builder.rows = {};
+        state.ResumeTiming();
+
+        const auto time_round = [&](std::string const& name, auto&& round) {
+            auto start = std::chrono::steady_clock::now();
+            round();
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            round_ms[name] += std::chrono::duration<double, std::milli>(elapsed).count();
+        };
+        time_round("preamble_ms", [&] { prover.execute_preamble_round(); });
+        time_round("wire_commitments_ms", [&] { prover.execute_wire_commitments_round(); });
+        time_round("log_derivative_inverse_ms", [&] { prover.execute_log_derivative_inverse_round(); });
+        time_round("log_derivative_commitments_ms",
+                   [&] { prover.execute_log_derivative_inverse_commitments_round(); });
+        time_round("relation_check_ms", [&] { prover.execute_relation_check_rounds(); });
+        time_round("pcs_ms", [&] { prover.execute_pcs_rounds(); });
+        DoNotOptimize(prover.export_proof());
+    }
+
+    state.counters["circuit_size"] = static_cast<double>(circuit_size);
+    for (auto const& [name, ms] : round_ms) {
+        state.counters[name] = Counter(ms, Counter::kAvgIterations);
+    }
+}
+
+} // namespace
+
+#define AVM_BENCHMARKS(name, corpus)                                                                                   \
+    BENCHMARK_CAPTURE(gen_trace, name, corpus)->Arg(1 << 10)->Arg(1 << 14)->Unit(kMillisecond);                        \
+    BENCHMARK_CAPTURE(prove, name, corpus)->Arg(1 << 10)->Iterations(1)->Unit(kMillisecond)
+
+// ALU
+AVM_BENCHMARKS(add, &alu_corpus<OpCode::ADD>);
+AVM_BENCHMARKS(lt, &alu_corpus<OpCode::LT>);
+AVM_BENCHMARKS(xor, &alu_corpus<OpCode::XOR>);
+// Memory
+AVM_BENCHMARKS(mov, &mov_corpus);
+AVM_BENCHMARKS(calldata_copy, &calldata_copy_corpus);
+// Hashing gadgets
+AVM_BENCHMARKS(poseidon2, &poseidon2_corpus);
+AVM_BENCHMARKS(sha256_compression, &sha256_compression_corpus);
+AVM_BENCHMARKS(keccakf1600, &keccakf1600_corpus);
+// External calls
+AVM_BENCHMARKS(call, &call_corpus);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,16 @@
+#include "barretenberg/benchmark/relations_bench/sumcheck_round_bench.hpp"
+#include "barretenberg/vm/avm/generated/flavor.hpp"
+
+using namespace benchmark;
+
+namespace bb::benchmark::sumcheck_round {
+
+using AvmEngine = SumcheckProverRound<AvmFlavor>::Engine;
+
+// The AVM has over 700 entities, so even small circuits take a lot of memory
+BENCHMARK(compute_univariate<AvmFlavor, AvmEngine::ROW_MAJOR>)->DenseRange(10, 14, 2)->Unit(kMillisecond);
+BENCHMARK(compute_univariate<AvmFlavor, AvmEngine::COLUMN_MAJOR>)->DenseRange(10, 14, 2)->Unit(kMillisecond);
+
+} // namespace bb::benchmark::sumcheck_round
+
+BENCHMARK_MAIN();
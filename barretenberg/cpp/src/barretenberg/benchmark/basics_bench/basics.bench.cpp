@@ -164,6 +164,48 @@ void ff_invert(State& state)
     }
 }
 
+/**
+ * @brief Evaluate the cost of inverting a vector of field elements with Montgomery's trick on a single thread
+ *
+ * @param state
+ */
+void ff_batch_invert(State& state)
+{
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t num_elements = 1 << static_cast<size_t>(state.range(0));
+    std::vector<Fr> elements(num_elements);
+    for (auto& element : elements) {
+        element = Fr::random_element(&engine);
+    }
+
+    for (auto _ : state) {
+        Fr::batch_invert(elements);
+        DoNotOptimize(elements.data());
+    }
+}
+
+/**
+ * @brief Evaluate the cost of inverting a vector of field elements split into one chunk per thread
+ *
+ * @details Compare with ff_batch_invert to see the scaling across cores (the number of cores can be limited with the
+ * HARDWARE_CONCURRENCY environment variable)
+ * @param state
+ */
+void ff_parallel_batch_invert(State& state)
+{
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t num_elements = 1 << static_cast<size_t>(state.range(0));
+    std::vector<Fr> elements(num_elements);
+    for (auto& element : elements) {
+        element = Fr::random_element(&engine);
+    }
+
+    for (auto _ : state) {
+        Fr::parallel_batch_invert(elements);
+        DoNotOptimize(elements.data());
+    }
+}
+
 /**
  * @brief Evaluate how much conversion to montgomery costs (in cache)
  *
@@ -473,6 +515,8 @@ BENCHMARK(ff_addition)->Unit(kMicrosecond)->DenseRange(12, 30);
 BENCHMARK(ff_multiplication)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_sqr)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_invert)->Unit(kMicrosecond)->DenseRange(12, 19);
+BENCHMARK(ff_batch_invert)->Unit(kMicrosecond)->DenseRange(12, 22, 2);
+BENCHMARK(ff_parallel_batch_invert)->Unit(kMicrosecond)->DenseRange(12, 22, 2);
 BENCHMARK(ff_to_montgomery)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_from_montgomery)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_reduce)->Unit(kMicrosecond)->DenseRange(12, 29);
@@ -5,18 +5,54 @@
 #include "barretenberg/stdlib/primitives/curves/bn254.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <string>
+
 using namespace benchmark;
 using namespace bb;
 
 namespace {
 
+using Curve = stdlib::bn254<UltraCircuitBuilder>;
+using affine_element = Curve::AffineElementNative;
+using element_ct = Curve::Element;
+using scalar_ct = Curve::ScalarField;
+
 auto& engine = numeric::get_debug_randomness();
+
+/**
+ * @brief Reset the peak resident set size of the process, so that peak_rss_mib() only accounts for what follows
+ * @note Linux only; elsewhere the peak covers the whole lifetime of the process.
+ */
+void reset_peak_rss()
+{
+#ifdef __linux__
+    std::ofstream("/proc/self/clear_refs") << "5";
+#endif
+}
+
+/**
+ * @brief Peak resident set size of the process since the last reset_peak_rss(), in MiB (0 if unavailable)
+ */
+double peak_rss_mib()
+{
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.starts_with("VmHWM:")) {
+            return std::stod(line.substr(6)) / 1024; // reported in kB
+        }
+    }
+#endif
+    return 0;
+}
+
 void biggroup_construction_bench(State& state)
 {
-    using Curve = stdlib::bn254<UltraCircuitBuilder>;
-    using affine_element = Curve::AffineElementNative;
-    using element_ct = Curve::Element;
-    using scalar_ct = Curve::ScalarField;
+    double peak_rss = 0;
     for (auto _ : state) {
         state.PauseTiming();
 
@@ -35,12 +71,78 @@ void biggroup_construction_bench(State& state)
             circuit_points.push_back(element_ct::from_witness(&builder, points[i]));
             circuit_scalars.push_back(scalar_ct::from_witness(&builder, scalars[i]));
         }
+        reset_peak_rss();
         state.ResumeTiming();
         element_ct::batch_mul(circuit_points, circuit_scalars);
         state.PauseTiming();
+        peak_rss = std::max(peak_rss, peak_rss_mib());
+    }
+    state.counters["peak_rss_mib"] = peak_rss;
+}
+
+void construct_batch_mul_circuit(UltraCircuitBuilder& builder,
+                                 const std::vector<affine_element>& points,
+                                 const std::vector<fr>& scalars)
+{
+    std::vector<element_ct> circuit_points;
+    std::vector<scalar_ct> circuit_scalars;
+    for (size_t i = 0; i < points.size(); ++i) {
+        circuit_points.push_back(element_ct::from_witness(&builder, points[i]));
+        circuit_scalars.push_back(scalar_ct::from_witness(&builder, scalars[i]));
+    }
+    element_ct::batch_mul(circuit_points, circuit_scalars);
+    builder.finalize_circuit();
+}
+
+/**
+ * @brief Construct and finalize a complete batch_mul circuit, either into a default builder or into a builder whose
+ * storage is sized from the profile of a previous construction of the same circuit
+ * @details Reports the peak resident set size reached while constructing the circuit.
+ */
+void ultra_construction_bench(State& state, bool presized) noexcept
+{
+    const auto num_points = static_cast<size_t>(state.range(0));
+    std::vector<affine_element> points;
+    std::vector<fr> scalars;
+    for (size_t i = 0; i < num_points; ++i) {
+        points.push_back(affine_element(Curve::ElementNative::random_element(&engine)));
+        scalars.push_back(fr::random_element(&engine));
+    }
+
+    CircuitSizeProfile size_profile;
+    if (presized) {
+        UltraCircuitBuilder builder;
+        construct_batch_mul_circuit(builder, points, scalars);
+        size_profile = builder.get_size_profile();
+    }
+
+    double peak_rss = 0;
+    size_t num_gates = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        reset_peak_rss();
+        state.ResumeTiming();
+        auto builder = presized ? std::make_unique<UltraCircuitBuilder>(size_profile)
+                                : std::make_unique<UltraCircuitBuilder>();
+        construct_batch_mul_circuit(*builder, points, scalars);
+        state.PauseTiming();
+        peak_rss = std::max(peak_rss, peak_rss_mib());
+        num_gates = builder->get_num_gates();
+        builder.reset(); // keep the deallocation out of the measurement
+        state.ResumeTiming();
     }
+    state.counters["gates"] = static_cast<double>(num_gates);
+    state.counters["peak_rss_mib"] = peak_rss;
 }
 } // namespace
 BENCHMARK(biggroup_construction_bench)->Unit(kMicrosecond)->DenseRange(2, 20);
+BENCHMARK_CAPTURE(ultra_construction_bench, default_storage, false)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(4, 64);
+BENCHMARK_CAPTURE(ultra_construction_bench, presized_storage, true)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(4, 64);
 
 BENCHMARK_MAIN();
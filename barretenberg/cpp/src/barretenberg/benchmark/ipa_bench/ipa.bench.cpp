@@ -66,6 +66,44 @@ void ipa_verify(State& state) noexcept
         ASSERT(result);
     }
 }
+
+/**
+ * @brief Verify NUM_BATCHED_CLAIMS proofs of the given size either one by one or through the batch verifier, which
+ * shares a single MSM over the SRS between all of them
+ */
+constexpr size_t NUM_BATCHED_CLAIMS = 8;
+void ipa_verify_batch(State& state, bool batched) noexcept
+{
+    const size_t claim_index = static_cast<size_t>(state.range(0)) - MIN_POLYNOMIAL_DEGREE_LOG2;
+    for (auto _ : state) {
+        state.PauseTiming();
+        // Reuse the same proof for every claim in the batch
+        std::vector<OpeningClaim<Curve>> batch_claims(NUM_BATCHED_CLAIMS, opening_claims[claim_index]);
+        std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts;
+        for (size_t i = 0; i < NUM_BATCHED_CLAIMS; i++) {
+            verifier_transcripts.push_back(
+                std::make_shared<NativeTranscript>(prover_transcripts[claim_index]->proof_data));
+        }
+        state.ResumeTiming();
+        if (batched) {
+            auto result = IPA<Curve>::batch_reduce_verify(vk, batch_claims, verifier_transcripts);
+            ASSERT(result);
+        } else {
+            for (size_t i = 0; i < NUM_BATCHED_CLAIMS; i++) {
+                auto result = IPA<Curve>::reduce_verify(vk, batch_claims[i], verifier_transcripts[i]);
+                ASSERT(result);
+            }
+        }
+    }
+}
+void ipa_verify_sequential_8(State& state) noexcept
+{
+    ipa_verify_batch(state, false);
+}
+void ipa_verify_batched_8(State& state) noexcept
+{
+    ipa_verify_batch(state, true);
+}
 } // namespace
 BENCHMARK(ipa_open)
     ->Unit(kMillisecond)
@@ -75,4 +113,12 @@ BENCHMARK(ipa_verify)
     ->Unit(kMillisecond)
     ->DenseRange(MIN_POLYNOMIAL_DEGREE_LOG2, MAX_POLYNOMIAL_DEGREE_LOG2)
     ->Setup(DoSetup);
+BENCHMARK(ipa_verify_sequential_8)
+    ->Unit(kMillisecond)
+    ->DenseRange(MIN_POLYNOMIAL_DEGREE_LOG2, MAX_POLYNOMIAL_DEGREE_LOG2)
+    ->Setup(DoSetup);
+BENCHMARK(ipa_verify_batched_8)
+    ->Unit(kMillisecond)
+    ->DenseRange(MIN_POLYNOMIAL_DEGREE_LOG2, MAX_POLYNOMIAL_DEGREE_LOG2)
+    ->Setup(DoSetup);
 BENCHMARK_MAIN();
\ No newline at end of file
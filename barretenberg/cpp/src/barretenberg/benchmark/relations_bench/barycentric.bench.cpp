@@ -23,6 +23,37 @@ void extend_2_to_6(State& state) noexcept
 }
 BENCHMARK(extend_2_to_6);
 
+void extend_6_to_12(State& state) noexcept
+{
+    auto univariate = Univariate<FF, 6>::get_random();
+    for (auto _ : state) {
+        DoNotOptimize(univariate.extend_to<12>());
+    }
+}
+BENCHMARK(extend_6_to_12);
+
+void evaluate_8(State& state) noexcept
+{
+    auto univariate = Univariate<FF, 8>::get_random();
+    FF u = FF::random_element();
+    for (auto _ : state) {
+        DoNotOptimize(univariate.evaluate(u));
+    }
+}
+BENCHMARK(evaluate_8);
+
+void multiply_add_8(State& state) noexcept
+{
+    auto a = Univariate<FF, 8>::get_random();
+    auto b = Univariate<FF, 8>::get_random();
+    auto c = Univariate<FF, 8>::get_random();
+    for (auto _ : state) {
+        a = a * b + c;
+        DoNotOptimize(a);
+    }
+}
+BENCHMARK(multiply_add_8);
+
 } // namespace bb::benchmark
 
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,23 @@
+#include "barretenberg/benchmark/relations_bench/sumcheck_round_bench.hpp"
+#include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
+
+using namespace benchmark;
+
+namespace bb::benchmark::sumcheck_round {
+
+using UltraEngine = SumcheckProverRound<UltraFlavor>::Engine;
+using MegaEngine = SumcheckProverRound<MegaFlavor>::Engine;
+
+BENCHMARK(compute_univariate<UltraFlavor, UltraEngine::ROW_MAJOR>)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+BENCHMARK(compute_univariate<UltraFlavor, UltraEngine::COLUMN_MAJOR>)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+BENCHMARK(compute_univariate<MegaFlavor, MegaEngine::ROW_MAJOR>)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+BENCHMARK(compute_univariate<MegaFlavor, MegaEngine::COLUMN_MAJOR>)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+BENCHMARK(prove<UltraFlavor, false>)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+BENCHMARK(prove<UltraFlavor, true>)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+BENCHMARK(prove<MegaFlavor, false>)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+BENCHMARK(prove<MegaFlavor, true>)->DenseRange(14, 18, 2)->Unit(kMillisecond);
+
+} // namespace bb::benchmark::sumcheck_round
+
+BENCHMARK_MAIN();
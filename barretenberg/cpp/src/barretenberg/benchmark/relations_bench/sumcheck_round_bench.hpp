@@ -0,0 +1,92 @@
+#pragma once
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/polynomials/gate_separator.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include "barretenberg/sumcheck/sumcheck.hpp"
+
+namespace bb::benchmark::sumcheck_round {
+
+/**
+ * @brief Compute the univariate of the first sumcheck round of a circuit of size 2^state.range(0) with the given engine
+ *
+ * @details The polynomials are random, so that no relation is ever skipped: this measures the cost of evaluating the
+ * relations rather than the sparsity of a particular circuit.
+ */
+template <typename Flavor, typename SumcheckProverRound<Flavor>::Engine engine>
+void compute_univariate(::benchmark::State& state)
+{
+    using FF = typename Flavor::FF;
+
+    const auto log_circuit_size = static_cast<size_t>(state.range(0));
+    const size_t circuit_size = 1UL << log_circuit_size;
+    typename Flavor::ProverPolynomials polynomials;
+    for (auto& polynomial : polynomials.get_all()) {
+        polynomial = Polynomial<FF>::random(circuit_size);
+    }
+    auto relation_parameters = RelationParameters<FF>::get_random();
+    std::vector<FF> betas(log_circuit_size);
+    for (auto& beta : betas) {
+        beta = FF::random_element();
+    }
+    GateSeparatorPolynomial<FF> gate_separators(betas, log_circuit_size);
+    typename Flavor::RelationSeparator alpha;
+    for (auto& alpha_i : alpha) {
+        alpha_i = FF::random_element();
+    }
+
+    SumcheckProverRound<Flavor> round(circuit_size);
+    round.engine = engine;
+    for (auto _ : state) {
+        auto univariate = round.compute_univariate(0, polynomials, relation_parameters, gate_separators, alpha);
+        ::benchmark::DoNotOptimize(univariate);
+    }
+}
+
+/**
+ * @brief Run the sumcheck prover on a circuit of size 2^state.range(0), with or without fused partial evaluation
+ *
+ * @details Besides the time, reports an estimate of the memory traffic over the tables of the rounds. The prover
+ * polynomials are read by the first round and by the first partial evaluation. Every later table is written by a
+ * partial evaluation and read by the next one, and in the default mode it is also read back by its round univariate,
+ * whereas the fused mode computes the round univariate from the rows it has just written.
+ */
+template <typename Flavor, bool fused> void prove(::benchmark::State& state)
+{
+    using FF = typename Flavor::FF;
+
+    const auto log_circuit_size = static_cast<size_t>(state.range(0));
+    const size_t circuit_size = 1UL << log_circuit_size;
+    typename Flavor::ProverPolynomials polynomials;
+    for (auto& polynomial : polynomials.get_all()) {
+        polynomial = Polynomial<FF>::random(circuit_size);
+    }
+    auto relation_parameters = RelationParameters<FF>::get_random();
+    std::vector<FF> gate_challenges(log_circuit_size);
+    for (auto& gate_challenge : gate_challenges) {
+        gate_challenge = FF::random_element();
+    }
+    typename Flavor::RelationSeparator alpha;
+    for (auto& alpha_i : alpha) {
+        alpha_i = FF::random_element();
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto transcript = Flavor::Transcript::prover_init_empty();
+        SumcheckProver<Flavor> sumcheck(circuit_size, transcript);
+        sumcheck.fused_partial_evaluation = fused;
+        state.ResumeTiming();
+        auto output = sumcheck.prove(polynomials, relation_parameters, alpha, gate_challenges);
+        ::benchmark::DoNotOptimize(output);
+    }
+
+    size_t rows = 2 * circuit_size;
+    for (size_t table_size = circuit_size / 2; table_size > 0; table_size /= 2) {
+        rows += (fused ? 2 : 3) * table_size;
+    }
+    state.counters["table_traffic_MiB"] =
+        static_cast<double>(rows * Flavor::NUM_ALL_ENTITIES * sizeof(FF)) / static_cast<double>(1UL << 20);
+}
+
+} // namespace bb::benchmark::sumcheck_round
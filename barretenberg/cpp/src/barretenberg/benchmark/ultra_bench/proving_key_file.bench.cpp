@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/benchmark/ultra_bench/mock_circuits.hpp"
+#include "barretenberg/honk/proof_system/proving_key_file.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "barretenberg/sumcheck/instance/prover_instance.hpp"
+
+#include <filesystem>
+#include <unistd.h>
+
+using namespace benchmark;
+using namespace bb;
+
+/**
+ * @brief Benchmark: Loading the precomputed part of an Ultra Honk proving key with 2**n gates from a ProvingKeyFile
+ * @details The key is written once, outside of the measurement, so its file is in the page cache as for a repeated
+ * proof of the same program. Each iteration maps the file and allocates the witness polynomials; the commitment key
+ * only depends on the circuit size and is reused, as by a prover that keeps it between proofs.
+ */
+static void read_proving_key_file_power_of_2(State& state) noexcept
+{
+    srs::init_crs_factory("../srs_db/ignition");
+    const auto log2_of_gates = static_cast<size_t>(state.range(0));
+    UltraCircuitBuilder builder;
+    mock_circuits::generate_basic_arithmetic_circuit(builder, log2_of_gates);
+    ProverInstance_<UltraFlavor> instance(builder);
+
+    const auto path = std::filesystem::temp_directory_path() /
+                      ("proving_key_file_bench_" + std::to_string(getpid()) + "_" + std::to_string(log2_of_gates));
+    ProvingKeyFile<UltraFlavor>::write(path, instance.proving_key);
+    for (auto _ : state) {
+        auto proving_key = ProvingKeyFile<UltraFlavor>::read(path, instance.proving_key.commitment_key);
+        DoNotOptimize(proving_key);
+    }
+    state.counters["file_bytes"] = static_cast<double>(std::filesystem::file_size(path));
+    std::filesystem::remove(path);
+}
+
+BENCHMARK(read_proving_key_file_power_of_2)
+    // 2**15 gates to 2**20 gates
+    ->DenseRange(15, 20)
+    ->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
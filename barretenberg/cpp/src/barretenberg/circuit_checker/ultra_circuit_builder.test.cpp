@@ -43,6 +43,48 @@ TEST(ultra_circuit_constructor, copy_constructor)
     EXPECT_TRUE(CircuitChecker::check(duplicate_circuit_constructor));
 }
 
+/**
+ * @brief A builder presized from the profile of a previous construction never reallocates its variables or blocks
+ */
+TEST(ultra_circuit_constructor, presized_from_size_profile)
+{
+    const auto construct_circuit = [](UltraCircuitBuilder& builder) {
+        MockCircuits::add_arithmetic_gates(builder, 100);
+        MockCircuits::add_lookup_gates(builder);
+        const auto range_idx = builder.add_variable(fr(1234));
+        builder.create_new_range_constraint(range_idx, 4321);
+        builder.create_dummy_constraints({ range_idx });
+        builder.finalize_circuit();
+    };
+
+    UltraCircuitBuilder reference_builder;
+    construct_circuit(reference_builder);
+    auto size_profile = reference_builder.get_size_profile();
+
+    UltraCircuitBuilder builder(size_profile);
+    const auto* variables_data = builder.variables.data();
+    std::vector<const uint32_t*> wires_data;
+    std::vector<const fr*> selectors_data;
+    for (auto& block : builder.blocks.get()) {
+        wires_data.push_back(block.wires[0].data());
+        selectors_data.push_back(block.selectors[0].data());
+    }
+
+    construct_circuit(builder);
+
+    EXPECT_EQ(builder.get_size_profile(), size_profile);
+    EXPECT_EQ(builder.variables.data(), variables_data);
+    size_t block_idx = 0;
+    for (auto& block : builder.blocks.get()) {
+        if (block.size() > 0) {
+            EXPECT_EQ(block.wires[0].data(), wires_data[block_idx]);
+            EXPECT_EQ(block.selectors[0].data(), selectors_data[block_idx]);
+        }
+        block_idx++;
+    }
+    EXPECT_TRUE(CircuitChecker::check(builder));
+}
+
 TEST(ultra_circuit_constructor, create_gates_from_plookup_accumulators)
 {
 
@@ -121,6 +163,28 @@ TEST(ultra_circuit_constructor, bad_lookup_failure)
     EXPECT_FALSE(CircuitChecker::check(builder));
 }
 
+/**
+ * @brief Circuits using the same basic table refer to a single shared instance but keep their own lookups
+ */
+TEST(ultra_circuit_constructor, lookup_tables_are_shared)
+{
+    UltraCircuitBuilder builder_1;
+    UltraCircuitBuilder builder_2;
+    MockCircuits::add_lookup_gates(builder_1, /*num_iterations=*/2);
+    MockCircuits::add_lookup_gates(builder_2, /*num_iterations=*/1);
+
+    ASSERT_EQ(builder_1.lookup_tables.size(), 1);
+    ASSERT_EQ(builder_2.lookup_tables.size(), 1);
+    const auto& table_1 = builder_1.lookup_tables[0];
+    const auto& table_2 = builder_2.lookup_tables[0];
+    EXPECT_EQ(table_1.table, table_2.table);
+    EXPECT_EQ(table_1.table, &plookup::get_basic_table(table_1.id()));
+    EXPECT_EQ(table_1.lookup_gates.size(), 2 * table_2.lookup_gates.size());
+
+    EXPECT_TRUE(CircuitChecker::check(builder_1));
+    EXPECT_TRUE(CircuitChecker::check(builder_2));
+}
+
 TEST(ultra_circuit_constructor, base_case)
 {
     UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
@@ -530,6 +594,41 @@ TEST(ultra_circuit_constructor, range_with_gates_where_range_is_not_a_power_of_t
     EXPECT_EQ(result, true);
 }
 
+/**
+ * @brief Processing all range lists at once lays out variables and gates exactly as processing them one at a time
+ */
+TEST(ultra_circuit_constructor, process_range_lists_matches_sequential)
+{
+    // Lists of several sizes, including ones that fit within a single gate
+    const auto construct_circuit = [](UltraCircuitBuilder& builder) {
+        const std::array<uint64_t, 4> target_ranges{ 3, 12, 100, 1000 };
+        for (size_t i = 0; i < target_ranges.size(); ++i) {
+            std::vector<uint32_t> indices;
+            for (size_t j = 0; j < 2 + 7 * i; ++j) {
+                indices.emplace_back(builder.add_variable(fr((j * 7) % (target_ranges[i] + 1))));
+                builder.create_new_range_constraint(indices.back(), target_ranges[i]);
+            }
+            builder.create_dummy_constraints(indices);
+        }
+    };
+
+    UltraCircuitBuilder builder;
+    construct_circuit(builder);
+    builder.finalize_circuit();
+
+    UltraCircuitBuilder reference_builder;
+    construct_circuit(reference_builder);
+    for (auto& [target_range, list] : reference_builder.range_lists) {
+        reference_builder.process_range_list(list);
+    }
+
+    EXPECT_EQ(builder.blocks, reference_builder.blocks);
+    EXPECT_EQ(builder.variables, reference_builder.variables);
+    EXPECT_EQ(builder.real_variable_tags, reference_builder.real_variable_tags);
+    EXPECT_EQ(builder.num_gates, reference_builder.num_gates);
+    EXPECT_TRUE(CircuitChecker::check(builder));
+}
+
 TEST(ultra_circuit_constructor, sort_widget_complex)
 {
     {
@@ -646,6 +745,24 @@ TEST(ultra_circuit_constructor, non_native_field_multiplication)
     EXPECT_EQ(result, true);
 }
 
+TEST(ultra_circuit_constructor, deduplicate_non_native_field_multiplications)
+{
+    using Multiplication = UltraCircuitBuilder::cached_partial_non_native_field_multiplication;
+    const auto multiplication = [](uint32_t a, uint32_t b) {
+        return Multiplication{ .a = { a, a, a, a, a }, .b = { b, b, b, b, b }, .lo_0 = 0, .hi_0 = 0, .hi_1 = 0 };
+    };
+
+    std::vector<Multiplication> multiplications{ multiplication(3, 1), multiplication(1, 2), multiplication(3, 1),
+                                                 multiplication(0, 5), multiplication(1, 2), multiplication(3, 2) };
+    Multiplication::deduplicate(multiplications);
+
+    // The first occurrences are kept, in their original order
+    std::vector<Multiplication> expected{
+        multiplication(3, 1), multiplication(1, 2), multiplication(0, 5), multiplication(3, 2)
+    };
+    EXPECT_EQ(multiplications, expected);
+}
+
 TEST(ultra_circuit_constructor, rom)
 {
     UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
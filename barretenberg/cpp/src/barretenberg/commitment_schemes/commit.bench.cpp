@@ -146,6 +146,42 @@ template <typename Curve> void bench_commit_random_non_power_of_2(::benchmark::S
     }
 }
 
+// Generate a polynomial whose coefficients are random values of at most num_bits bits, e.g. a selector for num_bits = 1
+template <typename FF> Polynomial<FF> small_random_poly(const size_t size, const size_t num_bits)
+{
+    auto& engine = numeric::get_debug_randomness();
+    auto polynomial = Polynomial<FF>(size);
+    const uint64_t mask = num_bits == 64 ? ~uint64_t(0) : (uint64_t(1) << num_bits) - 1;
+    for (auto& coeff : polynomial) {
+        coeff = FF(engine.get_random_uint64() & mask);
+    }
+    return polynomial;
+}
+
+// Commit to a polynomial with small random coefficients of a given bit width, using the regular commit method
+template <typename Curve, size_t num_bits> void bench_commit_small(::benchmark::State& state)
+{
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    auto polynomial = small_random_poly<typename Curve::ScalarField>(num_points, num_bits);
+    for (auto _ : state) {
+        key->commit(polynomial);
+    }
+}
+
+// Commit to a polynomial with small random coefficients of a given bit width, only paying for the bits in use
+template <typename Curve, size_t num_bits> void bench_commit_small_with_bit_width_detection(::benchmark::State& state)
+{
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    auto polynomial = small_random_poly<typename Curve::ScalarField>(num_points, num_bits);
+    for (auto _ : state) {
+        key->commit_with_bit_width_detection(polynomial);
+    }
+}
+
 BENCHMARK(bench_commit_zero<curve::BN254>)
     ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
     ->Unit(benchmark::kMillisecond);
@@ -168,6 +204,26 @@ BENCHMARK(bench_commit_random_non_power_of_2<curve::BN254>)
     ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
     ->Unit(benchmark::kMillisecond);
 
+// Selector-like (0/1), tag-like (3 bits) and u32-like coefficients
+BENCHMARK(bench_commit_small<curve::BN254, 1>)
+    ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_small_with_bit_width_detection<curve::BN254, 1>)
+    ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_small<curve::BN254, 3>)
+    ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_small_with_bit_width_detection<curve::BN254, 3>)
+    ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_small<curve::BN254, 32>)
+    ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_small_with_bit_width_detection<curve::BN254, 32>)
+    ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
+    ->Unit(benchmark::kMillisecond);
+
 } // namespace bb
 
 BENCHMARK_MAIN();
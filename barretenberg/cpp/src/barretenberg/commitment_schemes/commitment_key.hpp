@@ -8,6 +8,7 @@
  */
 
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
@@ -16,9 +17,11 @@
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <string_view>
+#include <vector>
 
 namespace bb {
 
@@ -48,6 +51,22 @@ template <class Curve> class CommitmentKey {
     }
 
   public:
+    /**
+     * @brief Shape of the coefficients of a polynomial, which determines the cheapest way to commit to it
+     */
+    enum class PolynomialType {
+        ZERO,    // all coefficients are zero; the commitment is the point at infinity
+        BOOLEAN, // all coefficients are 0 or 1 (e.g. selectors); committed with additions only
+        SMALL,   // coefficients of at most SMALL_SCALAR_MAX_BITS bits (e.g. tags, u32); committed with small_scalar_msm
+        SPARSE,  // at most half of the coefficients are nonzero; committed with commit_sparse
+        DENSE,   // committed with commit
+    };
+
+    struct PolynomialProfile {
+        PolynomialType type = PolynomialType::ZERO;
+        size_t num_bits = 0; // bit width of the largest coefficient; only meaningful for BOOLEAN and SMALL
+    };
+
     scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<srs::factories::CrsFactory<Curve>> crs_factory;
     std::shared_ptr<srs::factories::ProverCrs<Curve>> srs;
@@ -160,6 +179,89 @@ template <class Curve> class CommitmentKey {
         // Call the version of pippenger which assumes all points are distinct
         return scalar_multiplication::pippenger_unsafe<Curve>(scalars, points.data(), pippenger_runtime_state);
     }
+
+    /**
+     * @brief Commit to a polynomial, running only as many MSM windows as the bit width of its coefficients requires
+     * @details Adds a pass over the coefficients to the cost of commit, which is repaid many times over whenever the
+     * coefficients are small (see scalar_multiplication::pippenger_unsafe_optimized_for_small_scalars).
+     */
+    Commitment commit_with_bit_width_detection(std::span<const Fr> polynomial)
+    {
+        BB_OP_COUNT_TIME();
+        const size_t consumed_srs = numeric::round_up_power_2(polynomial.size());
+        ASSERT(consumed_srs <= srs->get_monomial_size());
+        return scalar_multiplication::pippenger_unsafe_optimized_for_small_scalars<Curve>(
+            polynomial, { srs->get_monomial_points(), srs->get_monomial_size() }, pippenger_runtime_state);
+    }
+
+    /**
+     * @brief Determine the type of a polynomial's coefficients, see PolynomialType
+     */
+    static PolynomialProfile profile(std::span<const Fr> polynomial)
+    {
+        using scalar_multiplication::SMALL_SCALAR_MAX_BITS;
+        const size_t num_bits = scalar_multiplication::get_scalar_bit_width<Curve>(polynomial);
+        if (num_bits == 0) {
+            return { PolynomialType::ZERO, 0 };
+        }
+        if (num_bits == 1) {
+            return { PolynomialType::BOOLEAN, num_bits };
+        }
+        if (num_bits <= SMALL_SCALAR_MAX_BITS) {
+            return { PolynomialType::SMALL, num_bits };
+        }
+        const auto num_nonzero = static_cast<size_t>(std::count_if(
+            polynomial.begin(), polynomial.end(), [](const Fr& coefficient) { return !coefficient.is_zero(); }));
+        return { 2 * num_nonzero <= polynomial.size() ? PolynomialType::SPARSE : PolynomialType::DENSE, num_bits };
+    }
+
+    /**
+     * @brief Commit to a batch of polynomials, using the cheapest method for each
+     * @details The polynomials are first profiled in parallel (see PolynomialType). Zero polynomials are committed to
+     * for free and boolean/small ones with small_scalar_msm, spread across cores one polynomial per task. The
+     * remaining polynomials go through pippenger, which shares this key's runtime state and is already multithreaded,
+     * so they are committed one after the other.
+     *
+     * @param polynomials a range of polynomials (e.g. a RefVector of a flavor's entities)
+     * @return the commitments, in the order of the input
+     */
+    template <typename Polynomials> std::vector<Commitment> batch_commit(Polynomials&& polynomials)
+    {
+        BB_OP_COUNT_TIME();
+        std::vector<std::span<const Fr>> spans;
+        for (const auto& polynomial : polynomials) {
+            spans.emplace_back(polynomial);
+        }
+        const size_t num_polynomials = spans.size();
+
+        std::vector<PolynomialProfile> profiles(num_polynomials);
+        parallel_for(num_polynomials, [&](size_t idx) { profiles[idx] = profile(spans[idx]); });
+
+        std::vector<Commitment> commitments(num_polynomials);
+        parallel_for(num_polynomials, [&](size_t idx) {
+            switch (profiles[idx].type) {
+            case PolynomialType::ZERO:
+                commitments[idx] = Commitment::infinity();
+                break;
+            case PolynomialType::BOOLEAN:
+            case PolynomialType::SMALL:
+                ASSERT(spans[idx].size() <= srs->get_monomial_size());
+                commitments[idx] = scalar_multiplication::small_scalar_msm<Curve>(
+                    spans[idx], srs->get_monomial_points(), profiles[idx].num_bits);
+                break;
+            default:
+                break;
+            }
+        });
+        for (size_t idx = 0; idx < num_polynomials; ++idx) {
+            if (profiles[idx].type == PolynomialType::SPARSE) {
+                commitments[idx] = commit_sparse(spans[idx]);
+            } else if (profiles[idx].type == PolynomialType::DENSE) {
+                commitments[idx] = commit(spans[idx]);
+            }
+        }
+        return commitments;
+    }
 };
 
 } // namespace bb
@@ -1,6 +1,7 @@
 
 #include "gemini.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/polynomials/span_kernels.hpp"
 
 #include <bit>
 #include <memory>
@@ -110,14 +111,12 @@ std::vector<typename GeminiProver_<Curve>::Polynomial> GeminiProver_<Curve>::com
 
         parallel_for(num_used_threads, [&](size_t i) {
             size_t current_chunk_size = (i == (num_used_threads - 1)) ? last_chunk_size : chunk_size;
-            for (std::ptrdiff_t j = (std::ptrdiff_t)(i * chunk_size);
-                 j < (std::ptrdiff_t)((i * chunk_size) + current_chunk_size);
-                 j++) {
-                // fold(Aₗ)[j] = (1-uₗ)⋅even(Aₗ)[j] + uₗ⋅odd(Aₗ)[j]
-                //            = (1-uₗ)⋅Aₗ[2j]      + uₗ⋅Aₗ[2j+1]
-                //            = Aₗ₊₁[j]
-                A_l_fold[j] = A_l[j << 1] + u_l * (A_l[(j << 1) + 1] - A_l[j << 1]);
-            }
+            // fold(Aₗ)[j] = (1-uₗ)⋅even(Aₗ)[j] + uₗ⋅odd(Aₗ)[j]
+            //            = (1-uₗ)⋅Aₗ[2j]      + uₗ⋅Aₗ[2j+1]
+            //            = Aₗ₊₁[j]
+            span_kernels::fold<Fr>(std::span{ A_l_fold + (i * chunk_size), current_chunk_size },
+                                   std::span<const Fr>{ A_l + (2 * i * chunk_size), 2 * current_chunk_size },
+                                   u_l);
         });
         // set Aₗ₊₁ = Aₗ for the next iteration
         A_l = A_l_fold;
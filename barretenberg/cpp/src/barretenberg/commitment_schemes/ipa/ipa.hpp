@@ -9,6 +9,7 @@
 #include <cstddef>
 #include <numeric>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -93,6 +94,64 @@ template <typename Curve_> class IPA {
 #ifdef IPA_FUZZ_TEST
    friend class ProxyCaller;
 #endif
+   /**
+    * @brief Data the native verifier derives from a single IPA proof before computing \f$G_0\f$
+    *
+    * @details Verifying the claim amounts to checking \f$C_0 = a_0\langle\vec{s},\vec{G}\rangle + a_0 b_0 U\f$. Keeping
+    * the pieces separate lets several claims share the MSM over \f$\vec{G}\f$, see \link IPA::batch_reduce_verify
+    * batch_reduce_verify \endlink.
+    */
+   struct ReducedClaim {
+       GroupElement C_zero;
+       Commitment aux_generator;
+       Fr a_zero;
+       Fr b_zero;
+       std::vector<Fr> s_vec;
+   };
+
+   /**
+    * @brief Build the pippenger point table {P_0, β·P_0, P_1, β·P_1, ...} of a vector of points in parallel
+    *
+    * @details Same layout as scalar_multiplication::generate_pippenger_point_table, but the table must not alias the
+    * input so that the entries can be written concurrently.
+    */
+   static void compute_pippenger_point_table(std::span<const Commitment> points, Commitment* table)
+   {
+       const auto beta = Curve::BaseField::cube_root_of_unity();
+       parallel_for_heuristic(
+           points.size(),
+           [&](size_t i) {
+               table[i * 2] = points[i];
+               table[i * 2 + 1].x = beta * points[i].x;
+               table[i * 2 + 1].y = -points[i].y;
+           }, thread_heuristics::FF_COPY_COST * 2 + thread_heuristics::FF_MULTIPLICATION_COST);
+   }
+
+   /**
+    * @brief Compute \f$\vec{s}=(1,u_{0}^{-1},u_{1}^{-1},u_{0}^{-1}u_{1}^{-1},...,\prod_{i=0}^{k-1}u_{i}^{-1})\f$ in
+    * linear time
+    *
+    * @details \f$s_i\f$ is the product of the inverse challenges selected by the set bits of \f$i\f$. The entries whose
+    * highest set bit is \f$j\f$ are the first \f$2^j\f$ entries multiplied by one more inverse challenge, so the vector
+    * is built level by level with a single multiplication per entry instead of \f$O(n\log n)\f$.
+    */
+   static std::vector<Fr> compute_s_vec(const std::vector<Fr>& round_challenges_inv, const size_t poly_length)
+   {
+       const size_t log_poly_degree = round_challenges_inv.size();
+       std::vector<Fr> s_vec(poly_length);
+       s_vec[0] = Fr::one();
+       for (size_t j = 0; j < log_poly_degree; j++) {
+           const size_t level_size = static_cast<size_t>(1) << j;
+           const Fr& challenge_inv = round_challenges_inv[log_poly_degree - 1 - j];
+           parallel_for_heuristic(
+               level_size,
+               [&](size_t i) {
+                   s_vec[level_size + i] = s_vec[i] * challenge_inv;
+               }, thread_heuristics::FF_MULTIPLICATION_COST);
+       }
+       return s_vec;
+   }
+
    /**
     * @brief Compute an inner product argument proof for opening a single polynomial at a single evaluation point.
     *
@@ -194,34 +253,41 @@ template <typename Curve_> class IPA {
         // Allocate space for L_i and R_i elements
         GroupElement L_i;
         GroupElement R_i;
-        std::size_t round_size = poly_length;
+        std::size_t round_size = poly_length / 2;
+
+        // The round MSMs consume pippenger point tables {G_0, β·G_0, G_1, β·G_1, ...}. In the first round this is
+        // exactly the SRS held by the commitment key, so a table only has to be built once G has been folded. The
+        // largest folded vector has poly_length / 2 points, so a single buffer of poly_length entries is reused.
+        Commitment* G_table = srs_elements;
+        std::vector<Commitment> G_table_local(poly_length);
+
+        // The cross inner products of the first round are computed here; every later round receives them from the
+        // folding pass of the previous round
+        Fr inner_prod_L;
+        Fr inner_prod_R;
+        std::tie(inner_prod_L, inner_prod_R) = sum_pairs(parallel_for_heuristic(
+            round_size,
+            std::pair{Fr::zero(), Fr::zero()},
+            [&](size_t j, std::pair<Fr, Fr>& inner_prod_left_right) {
+                // Compute inner_prod_L := < a_vec_lo, b_vec_hi >
+                inner_prod_left_right.first += a_vec[j] * b_vec[round_size + j];
+                // Compute inner_prod_R := < a_vec_hi, b_vec_lo >
+                inner_prod_left_right.second += a_vec[round_size + j] * b_vec[j];
+            }, thread_heuristics::FF_ADDITION_COST * 2 + thread_heuristics::FF_MULTIPLICATION_COST * 2));
 
         // Step 6.
         // Perform IPA reduction rounds
         for (size_t i = 0; i < log_poly_degree; i++) {
-            round_size /= 2;
-            // Run scalar products in parallel
-            auto inner_prods = parallel_for_heuristic(
-                round_size,
-                std::pair{Fr::zero(), Fr::zero()},
-                [&](size_t j, std::pair<Fr, Fr>& inner_prod_left_right) {
-                    // Compute inner_prod_L := < a_vec_lo, b_vec_hi >
-                    inner_prod_left_right.first += a_vec[j] * b_vec[round_size + j];
-                    // Compute inner_prod_R := < a_vec_hi, b_vec_lo >
-                    inner_prod_left_right.second += a_vec[round_size + j] * b_vec[j];
-                }, thread_heuristics::FF_ADDITION_COST * 2 + thread_heuristics::FF_MULTIPLICATION_COST * 2);
-            // Sum inner product contributions computed in parallel and unpack the std::pair
-            auto [inner_prod_L, inner_prod_R] = sum_pairs(inner_prods);
             // Step 6.a (using letters, because doxygen automaticall converts the sublist counters to letters :( )
             // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
-            L_i = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                {&a_vec[0], /*size*/ round_size}, &G_vec_local[round_size], ck->pippenger_runtime_state);
+            L_i = bb::scalar_multiplication::pippenger<Curve>(
+                {&a_vec[0], /*size*/ round_size}, G_table + 2 * round_size, ck->pippenger_runtime_state, false);
             L_i += aux_generator * inner_prod_L;
 
             // Step 6.b
             // R_i = < a_vec_hi, G_vec_lo > + inner_prod_R * aux_generator
-            R_i = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                {&a_vec[round_size], /*size*/ round_size}, &G_vec_local[0], ck->pippenger_runtime_state);
+            R_i = bb::scalar_multiplication::pippenger<Curve>(
+                {&a_vec[round_size], /*size*/ round_size}, G_table, ck->pippenger_runtime_state, false);
             R_i += aux_generator * inner_prod_R;
 
             // Step 6.c
@@ -241,25 +307,45 @@ template <typename Curve_> class IPA {
 
             // Step 6.e
             // G_vec_new = G_vec_lo + G_vec_hi * round_challenge_inv
-            auto G_hi_by_inverse_challenge = GroupElement::batch_mul_with_endomorphism(
-                std::span{ G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size),
-                           G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size * 2) },
-                round_challenge_inv);
-            GroupElement::batch_affine_add(
-                std::span{ G_vec_local.begin(), G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size) },
-                G_hi_by_inverse_challenge,
-                G_vec_local);
-
-            // Steps 6.e and 6.f
+            // The last round only needs a_0, so the generators are not folded any further
+            const size_t next_round_size = round_size / 2;
+            if (next_round_size > 0) {
+                auto G_hi_by_inverse_challenge = GroupElement::batch_mul_with_endomorphism(
+                    std::span{ G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size),
+                               G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size * 2) },
+                    round_challenge_inv);
+                GroupElement::batch_affine_add(
+                    std::span{ G_vec_local.begin(), G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size) },
+                    G_hi_by_inverse_challenge,
+                    G_vec_local);
+                compute_pippenger_point_table({ G_vec_local.data(), round_size }, G_table_local.data());
+                G_table = G_table_local.data();
+            }
+
+            // Steps 6.f and 6.g
             // Update the vectors a_vec, b_vec.
             // a_vec_new = a_vec_lo + a_vec_hi * round_challenge
             // b_vec_new = b_vec_lo + b_vec_hi * round_challenge_inv
-            parallel_for_heuristic(
-                round_size,
-                [&](size_t j) {
+            // Each task folds the entries j and next_round_size + j of the new vectors, so the cross inner products
+            // of the next round can be accumulated in the same pass instead of re-reading a_vec and b_vec.
+            if (next_round_size == 0) {
+                a_vec[0] += round_challenge * a_vec[1];
+                break;
+            }
+            auto next_inner_prods = parallel_for_heuristic(
+                next_round_size,
+                std::pair{Fr::zero(), Fr::zero()},
+                [&](size_t j, std::pair<Fr, Fr>& inner_prod_left_right) {
+                    const size_t k = next_round_size + j;
                     a_vec[j] += round_challenge * a_vec[round_size + j];
                     b_vec[j] += round_challenge_inv * b_vec[round_size + j];
-                }, thread_heuristics::FF_ADDITION_COST * 2 + thread_heuristics::FF_MULTIPLICATION_COST * 2);
+                    a_vec[k] += round_challenge * a_vec[round_size + k];
+                    b_vec[k] += round_challenge_inv * b_vec[round_size + k];
+                    inner_prod_left_right.first += a_vec[j] * b_vec[k];
+                    inner_prod_left_right.second += a_vec[k] * b_vec[j];
+                }, thread_heuristics::FF_ADDITION_COST * 6 + thread_heuristics::FF_MULTIPLICATION_COST * 6);
+            std::tie(inner_prod_L, inner_prod_R) = sum_pairs(next_inner_prods);
+            round_size = next_round_size;
         }
 
         // Step 7
@@ -296,6 +382,35 @@ template <typename Curve_> class IPA {
                                                       const OpeningClaim<Curve>& opening_claim,
                                                       auto& transcript)
         requires(!Curve::is_stdlib_type)
+    {
+        // Steps 1-7 and 9.
+        auto [C_zero, aux_generator, a_zero, b_zero, s_vec] = reduce_claim_internal(vk, opening_claim, transcript);
+
+        // Step 8.
+        // Compute G₀
+        // The SRS held by the verification key already is a pippenger point table, so no local copy of G is needed
+        Commitment G_zero = bb::scalar_multiplication::pippenger<Curve>(
+            { s_vec.data(), /*size*/ s_vec.size() }, vk->get_monomial_points(), vk->pippenger_runtime_state, false);
+
+        // Step 10.
+        // Compute C_right
+        GroupElement right_hand_side = G_zero * a_zero + aux_generator * a_zero * b_zero;
+
+        // Step 11.
+        // Check if C_right == C₀
+        return (C_zero.normalize() == right_hand_side.normalize());
+    }
+
+    /**
+     * @brief Natively process an IPA proof up to (but not including) the MSM computing \f$G_0\f$
+     *
+     * @details Runs steps 1-7 and 9 of \link IPA::reduce_verify_internal reduce_verify_internal \endlink, consuming
+     * every element of the proof from the transcript.
+     */
+    static ReducedClaim reduce_claim_internal(const std::shared_ptr<VK>& vk,
+                                              const OpeningClaim<Curve>& opening_claim,
+                                              auto& transcript)
+        requires(!Curve::is_stdlib_type)
     {
         // Step 1.
         // Receive polynomial_degree + 1 = d from the prover
@@ -360,53 +475,13 @@ template <typename Curve_> class IPA {
 
         // Step 7.
         // Construct vector s
-        std::vector<Fr> s_vec(poly_length, Fr::one());
-
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/857): This code is not efficient as its
-        // O(nlogn). This can be optimized to be linear by computing a tree of products. Its very readable, so we're
-        // leaving it unoptimized for now.
-        parallel_for_heuristic(
-            poly_length,
-            [&](size_t i) {
-                for (size_t j = (log_poly_degree - 1); j != static_cast<size_t>(-1); j--) {
-                    auto bit = (i >> j) & 1;
-                    bool b = static_cast<bool>(bit);
-                    if (b) {
-                        s_vec[i] *= round_challenges_inv[log_poly_degree - 1 - j];
-                    }
-                }
-            }, thread_heuristics::FF_MULTIPLICATION_COST * log_poly_degree);
-
-        auto* srs_elements = vk->get_monomial_points();
-
-        // Copy the G_vector to local memory.
-        std::vector<Commitment> G_vec_local(poly_length);
-
-        // The SRS stored in the commitment key is the result after applying the pippenger point table so the
-        // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
-        // G_vec_local should use only the original SRS thus we extract only the even indices.
-        parallel_for_heuristic(
-            poly_length,
-            [&](size_t i) {
-                G_vec_local[i] = srs_elements[i * 2];
-            }, thread_heuristics::FF_COPY_COST * 2);
-
-        // Step 8.
-        // Compute G₀
-        Commitment G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-            {&s_vec[0], /*size*/ poly_length}, &G_vec_local[0], vk->pippenger_runtime_state);
+        std::vector<Fr> s_vec = compute_s_vec(round_challenges_inv, poly_length);
 
         // Step 9.
         // Receive a₀ from the prover
         auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
 
-        // Step 10.
-        // Compute C_right
-        GroupElement right_hand_side = G_zero * a_zero + aux_generator * a_zero * b_zero;
-
-        // Step 11.
-        // Check if C_right == C₀
-        return (C_zero.normalize() == right_hand_side.normalize());
+        return { C_zero, aux_generator, a_zero, b_zero, std::move(s_vec) };
     }
     /**
      * @brief  Recursively verify the correctness of an IPA proof. Unlike native verification, there is no
@@ -572,6 +647,69 @@ template <typename Curve_> class IPA {
     {
         return reduce_verify_internal(vk, opening_claim, transcript);
     }
+
+    /**
+     * @brief Natively verify several IPA opening claims at once, sharing a single MSM over the SRS
+     *
+     * @param vk Verification key; its SRS and pippenger state must cover the longest of the opened polynomials
+     * @param opening_claims The claims, each containing the commitment C and opening pair \f$(\beta, f(\beta))\f$
+     * @param transcripts One transcript per claim, holding the corresponding proof
+     *
+     * @return true if and only if (with overwhelming probability) every proof verifies
+     *
+     * @details Each proof is reduced to the check \f$C_0^{(i)} = a_0^{(i)}\langle\vec{s}^{(i)},\vec{G}\rangle +
+     * a_0^{(i)}b_0^{(i)}U^{(i)}\f$. The \f$O(n)\f$ MSM computing \f$G_0\f$ dominates verification, so the checks are
+     * combined with powers of a random \f$\rho\f$ chosen by the verifier:
+     * \f$\sum_i\rho^i(C_0^{(i)} - a_0^{(i)}b_0^{(i)}U^{(i)}) =
+     * \langle\sum_i\rho^i a_0^{(i)}\vec{s}^{(i)},\vec{G}\rangle\f$, which costs one MSM of the longest length
+     * rather than one per claim.
+     */
+    template <typename Transcript>
+    static VerifierAccumulator batch_reduce_verify(const std::shared_ptr<VK>& vk,
+                                                   const std::vector<OpeningClaim<Curve>>& opening_claims,
+                                                   const std::vector<std::shared_ptr<Transcript>>& transcripts)
+        requires(!Curve::is_stdlib_type)
+    {
+        ASSERT(opening_claims.size() == transcripts.size() && "Every opening claim needs its own transcript");
+        if (opening_claims.empty()) {
+            return true;
+        }
+
+        const Fr batching_challenge = Fr::random_element();
+        Fr batching_scalar = Fr::one();
+
+        GroupElement left_hand_side = GroupElement::infinity();
+        std::vector<Fr> combined_s_vec;
+        for (size_t i = 0; i < opening_claims.size(); i++) {
+            const ReducedClaim reduced = reduce_claim_internal(vk, opening_claims[i], transcripts[i]);
+            const auto& s_vec = reduced.s_vec;
+
+            // Accumulate ρⁱ⋅(C₀ - a₀⋅b₀⋅U)
+            left_hand_side +=
+                (reduced.C_zero - reduced.aux_generator * (reduced.a_zero * reduced.b_zero)) * batching_scalar;
+
+            // Accumulate ρⁱ⋅a₀⋅s into the scalars of the shared MSM; shorter claims only touch a prefix of G
+            if (combined_s_vec.size() < s_vec.size()) {
+                combined_s_vec.resize(s_vec.size(), Fr::zero());
+            }
+            const Fr s_vec_scalar = batching_scalar * reduced.a_zero;
+            parallel_for_heuristic(
+                s_vec.size(),
+                [&](size_t j) { combined_s_vec[j] += s_vec[j] * s_vec_scalar; },
+                thread_heuristics::FF_ADDITION_COST + thread_heuristics::FF_MULTIPLICATION_COST);
+
+            batching_scalar *= batching_challenge;
+        }
+
+        // Compute ∑ᵢ ρⁱ⋅a₀⁽ⁱ⁾⋅G₀⁽ⁱ⁾ with a single MSM
+        GroupElement right_hand_side = bb::scalar_multiplication::pippenger<Curve>(
+            { combined_s_vec.data(), /*size*/ combined_s_vec.size() },
+            vk->get_monomial_points(),
+            vk->pippenger_runtime_state,
+            false);
+
+        return (left_hand_side.normalize() == right_hand_side.normalize());
+    }
 };
 
 } // namespace bb
\ No newline at end of file
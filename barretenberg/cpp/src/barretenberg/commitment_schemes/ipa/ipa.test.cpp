@@ -231,6 +231,36 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
 }
 
+TEST_F(IPATest, BatchVerify)
+{
+    using IPA = IPA<Curve>;
+    // Open polynomials of different lengths so that the shared MSM also covers claims using only a prefix of the SRS
+    const std::vector<size_t> lengths = { 128, 64, 128, 16 };
+
+    std::vector<OpeningClaim<Curve>> opening_claims;
+    std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts;
+    for (const size_t n : lengths) {
+        auto poly = this->random_polynomial(n);
+        auto [x, eval] = this->random_eval(poly);
+        auto commitment = this->commit(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        opening_claims.push_back({ opening_pair, commitment });
+
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA::compute_opening_proof(this->ck(), { poly, opening_pair }, prover_transcript);
+        verifier_transcripts.push_back(std::make_shared<NativeTranscript>(prover_transcript->proof_data));
+    }
+
+    EXPECT_TRUE(IPA::batch_reduce_verify(this->vk(), opening_claims, verifier_transcripts));
+
+    // A single wrong evaluation must make the whole batch fail
+    opening_claims[2].opening_pair.evaluation += Fr::one();
+    for (auto& transcript : verifier_transcripts) {
+        transcript = std::make_shared<NativeTranscript>(transcript->proof_data);
+    }
+    EXPECT_FALSE(IPA::batch_reduce_verify(this->vk(), opening_claims, verifier_transcripts));
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     using IPA = IPA<Curve>;
@@ -98,20 +98,24 @@ template <typename Curve> class ShplonkProver_ {
 
         // G₀ = ∑ⱼ ρʲ ⋅ vⱼ / ( r − xⱼ )
         Fr current_nu = Fr::one();
-        Polynomial tmp(G.size());
+        std::vector<std::span<const Fr>> polynomials;
+        std::vector<Fr> scaling_factors;
+        polynomials.reserve(num_opening_claims);
+        scaling_factors.reserve(num_opening_claims);
         size_t idx = 0;
         for (const auto& claim : opening_claims) {
-            // tmp = ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ )
-            tmp = claim.polynomial;
-            tmp[0] -= claim.opening_pair.evaluation;
             Fr scaling_factor = current_nu * inverse_vanishing_evals[idx]; // = ρʲ / ( r − xⱼ )
 
-            // G -= ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ )
-            G.add_scaled(tmp, -scaling_factor);
+            // G -= ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ ), where the constant term is handled here and fⱼ(X) below
+            G[0] += scaling_factor * claim.opening_pair.evaluation;
+            polynomials.emplace_back(claim.polynomial.as_span());
+            scaling_factors.emplace_back(-scaling_factor);
 
             current_nu *= nu_challenge;
             idx++;
         }
+        // Subtract all of the fⱼ(X) in one pass over G
+        G.add_scaled(polynomials, scaling_factors);
 
         // Return opening pair (z, 0) and polynomial G(X) = Q(X) - Q_z(X)
         return { .polynomial = G, .opening_pair = { .challenge = z_challenge, .evaluation = Fr::zero() } };
@@ -66,4 +66,37 @@ TYPED_TEST(CommitmentKeyTest, CommitSparse)
     EXPECT_EQ(sparse_commit_result, commit_result);
 }
 
+// Check that batch_commit agrees with commit on every type of polynomial it distinguishes
+TYPED_TEST(CommitmentKeyTest, BatchCommit)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+    using PolynomialType = typename CK::PolynomialType;
+
+    const size_t num_points = 1 << 12;
+    auto& engine = numeric::get_debug_randomness();
+
+    std::vector<Polynomial> polys(5, Polynomial{ num_points });
+    for (size_t i = 0; i < num_points; ++i) {
+        polys[1][i] = engine.get_random_uint8() & 1; // boolean
+        polys[2][i] = engine.get_random_uint8() % 7; // small
+        polys[3][i] = (i % 5 == 0) ? Fr::random_element() : Fr(0); // sparse
+        polys[4][i] = Fr::random_element(); // dense
+    }
+    const std::vector<PolynomialType> expected_types = { PolynomialType::ZERO,
+                                                         PolynomialType::BOOLEAN,
+                                                         PolynomialType::SMALL,
+                                                         PolynomialType::SPARSE,
+                                                         PolynomialType::DENSE };
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    auto commitments = key->batch_commit(polys);
+    for (size_t i = 0; i < polys.size(); ++i) {
+        EXPECT_EQ(CK::profile(polys[i]).type, expected_types[i]);
+        EXPECT_EQ(commitments[i], key->commit(polys[i]));
+    }
+}
+
 } // namespace bb
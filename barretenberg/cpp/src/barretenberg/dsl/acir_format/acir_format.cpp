@@ -375,11 +375,15 @@ UltraCircuitBuilder create_circuit(AcirFormat& constraint_system,
                                    WitnessVector const& witness,
                                    bool honk_recursion,
                                    [[maybe_unused]] std::shared_ptr<ECCOpQueue>,
-                                   bool collect_gates_per_opcode)
+                                   bool collect_gates_per_opcode,
+                                   std::optional<CircuitSizeProfile> const& size_profile)
 {
     Builder builder{
         size_hint, witness, constraint_system.public_inputs, constraint_system.varnum, constraint_system.recursive
     };
+    if (size_profile) {
+        builder.reserve(*size_profile);
+    }
 
     bool has_valid_witness_assignments = !witness.empty();
     build_constraints(
@@ -403,10 +407,14 @@ MegaCircuitBuilder create_circuit(AcirFormat& constraint_system,
                                   WitnessVector const& witness,
                                   bool honk_recursion,
                                   std::shared_ptr<ECCOpQueue> op_queue,
-                                  bool collect_gates_per_opcode)
+                                  bool collect_gates_per_opcode,
+                                  std::optional<CircuitSizeProfile> const& size_profile)
 {
     // Construct a builder using the witness and public input data from acir and with the goblin-owned op_queue
     auto builder = MegaCircuitBuilder{ op_queue, witness, constraint_system.public_inputs, constraint_system.varnum };
+    if (size_profile) {
+        builder.reserve(*size_profile);
+    }
 
     // Populate constraints in the builder via the data in constraint_system
     bool has_valid_witness_assignments = !witness.empty();
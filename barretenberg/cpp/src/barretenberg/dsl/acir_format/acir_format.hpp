@@ -19,6 +19,7 @@
 #include "recursion_constraint.hpp"
 #include "schnorr_verify.hpp"
 #include "sha256_constraint.hpp"
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -182,13 +183,19 @@ struct AcirProgramStack {
     void pop_back() { witness_stack.pop_back(); }
 };
 
+/**
+ * @brief Create a circuit from acir constraints and optionally a witness
+ * @param size_profile If provided, the builder's storage is reserved from it before any constraint is added (see
+ * bb::CircuitSizeProfile), e.g. when constructing a circuit of the same program again
+ */
 template <typename Builder = bb::UltraCircuitBuilder>
 Builder create_circuit(AcirFormat& constraint_system,
                        size_t size_hint = 0,
                        WitnessVector const& witness = {},
                        bool honk_recursion = false,
                        std::shared_ptr<bb::ECCOpQueue> op_queue = std::make_shared<bb::ECCOpQueue>(),
-                       bool collect_gates_per_opcode = false);
+                       bool collect_gates_per_opcode = false,
+                       std::optional<bb::CircuitSizeProfile> const& size_profile = std::nullopt);
 
 template <typename Builder>
 void build_constraints(
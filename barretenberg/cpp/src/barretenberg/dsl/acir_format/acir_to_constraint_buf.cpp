@@ -1,8 +1,11 @@
 #include "acir_to_constraint_buf.hpp"
 #include "barretenberg/common/container.hpp"
+#include <array>
 #include <cstddef>
+#include <span>
 #include <tuple>
 #include <utility>
+#include <variant>
 #ifndef __wasm__
 #include "barretenberg/bb/get_bytecode.hpp"
 #endif
@@ -557,6 +560,50 @@ void handle_memory_op(Program::Opcode::MemoryOp const& mem_op, BlockConstraint&
     block.trace.push_back(acir_mem_op);
 }
 
+// Map from a block id to a pair of: BlockConstraint, and list of opcodes associated with that BlockConstraint
+using BlockConstraintMap = std::unordered_map<uint32_t, std::pair<BlockConstraint, std::vector<size_t>>>;
+
+void handle_opcode(Program::Opcode const& opcode,
+                   AcirFormat& af,
+                   BlockConstraintMap& block_id_to_block_constraint,
+                   bool honk_recursion,
+                   size_t opcode_index)
+{
+    std::visit(
+        [&](auto&& arg) {
+            using T = std::decay_t<decltype(arg)>;
+            if constexpr (std::is_same_v<T, Program::Opcode::AssertZero>) {
+                handle_arithmetic(arg, af, opcode_index);
+            } else if constexpr (std::is_same_v<T, Program::Opcode::BlackBoxFuncCall>) {
+                handle_blackbox_func_call(arg, af, honk_recursion, opcode_index);
+            } else if constexpr (std::is_same_v<T, Program::Opcode::MemoryInit>) {
+                auto block = handle_memory_init(arg);
+                uint32_t block_id = arg.block_id.value;
+                std::vector<size_t> opcode_indices = { opcode_index };
+                block_id_to_block_constraint[block_id] = std::make_pair(block, opcode_indices);
+            } else if constexpr (std::is_same_v<T, Program::Opcode::MemoryOp>) {
+                auto block = block_id_to_block_constraint.find(arg.block_id.value);
+                if (block == block_id_to_block_constraint.end()) {
+                    throw_or_abort("unitialized MemoryOp");
+                }
+                handle_memory_op(arg, block->second.first);
+                block->second.second.push_back(opcode_index);
+            }
+        },
+        opcode.value);
+}
+
+void add_block_constraints(AcirFormat& af, BlockConstraintMap const& block_id_to_block_constraint)
+{
+    for (const auto& [block_id, block] : block_id_to_block_constraint) {
+        // Note: the trace will always be empty for ReturnData since it cannot be explicitly read from in noir
+        if (!block.first.trace.empty() || block.first.type == BlockType::ReturnData) {
+            af.block_constraints.push_back(block.first);
+            af.original_opcode_indices.block_constraints.push_back(block.second);
+        }
+    }
+}
+
 AcirFormat circuit_serde_to_acir_format(Program::Circuit const& circuit, bool honk_recursion)
 {
     AcirFormat af;
@@ -566,51 +613,311 @@ AcirFormat circuit_serde_to_acir_format(Program::Circuit const& circuit, bool ho
     af.num_acir_opcodes = static_cast<uint32_t>(circuit.opcodes.size());
     af.public_inputs = join({ map(circuit.public_parameters.value, [](auto e) { return e.value; }),
                               map(circuit.return_values.value, [](auto e) { return e.value; }) });
-    // Map to a pair of: BlockConstraint, and list of opcodes associated with that BlockConstraint
-    std::unordered_map<uint32_t, std::pair<BlockConstraint, std::vector<size_t>>> block_id_to_block_constraint;
+    BlockConstraintMap block_id_to_block_constraint;
     for (size_t i = 0; i < circuit.opcodes.size(); ++i) {
-        auto gate = circuit.opcodes[i];
-        std::visit(
-            [&](auto&& arg) {
-                using T = std::decay_t<decltype(arg)>;
-                if constexpr (std::is_same_v<T, Program::Opcode::AssertZero>) {
-                    handle_arithmetic(arg, af, i);
-                } else if constexpr (std::is_same_v<T, Program::Opcode::BlackBoxFuncCall>) {
-                    handle_blackbox_func_call(arg, af, honk_recursion, i);
-                } else if constexpr (std::is_same_v<T, Program::Opcode::MemoryInit>) {
-                    auto block = handle_memory_init(arg);
-                    uint32_t block_id = arg.block_id.value;
-                    std::vector<size_t> opcode_indices = { i };
-                    block_id_to_block_constraint[block_id] = std::make_pair(block, opcode_indices);
-                } else if constexpr (std::is_same_v<T, Program::Opcode::MemoryOp>) {
-                    auto block = block_id_to_block_constraint.find(arg.block_id.value);
-                    if (block == block_id_to_block_constraint.end()) {
-                        throw_or_abort("unitialized MemoryOp");
-                    }
-                    handle_memory_op(arg, block->second.first);
-                    block->second.second.push_back(i);
-                }
-            },
-            gate.value);
-    }
-    for (const auto& [block_id, block] : block_id_to_block_constraint) {
-        // Note: the trace will always be empty for ReturnData since it cannot be explicitly read from in noir
-        if (!block.first.trace.empty() || block.first.type == BlockType::ReturnData) {
-            af.block_constraints.push_back(block.first);
-            af.original_opcode_indices.block_constraints.push_back(block.second);
-        }
+        handle_opcode(circuit.opcodes[i], af, block_id_to_block_constraint, honk_recursion, i);
     }
+    add_block_constraints(af, block_id_to_block_constraint);
     return af;
 }
 
-AcirFormat circuit_buf_to_acir_format(std::vector<uint8_t> const& buf, bool honk_recursion)
+namespace {
+
+/*
+ * Brillig (unconstrained) functions play no part in constraint generation, so they are stepped over without being
+ * decoded. The skip functions below follow the layout written by the generated serializers in serde/acir.hpp: a struct
+ * is its fields in order, an enum is a u32 variant index followed by the fields of the variant, and a vector or string
+ * is a u64 length followed by its elements. The operands of most Brillig opcodes have a fixed size.
+ */
+constexpr size_t MEMORY_ADDRESS_SIZE = sizeof(uint64_t);
+constexpr size_t HEAP_ARRAY_SIZE = MEMORY_ADDRESS_SIZE + sizeof(uint64_t); // pointer, size
+constexpr size_t HEAP_VECTOR_SIZE = 2 * MEMORY_ADDRESS_SIZE;               // pointer, address of the size
+
+template <typename Enum> uint32_t read_variant_index(serde::BincodeDeserializer& deserializer)
+{
+    const uint32_t index = deserializer.deserialize_variant_index();
+    if (index >= std::variant_size_v<decltype(Enum::value)>) {
+        throw_or_abort("Unknown variant index for enum");
+    }
+    return index;
+}
+
+void skip_string(serde::BincodeDeserializer& deserializer)
+{
+    deserializer.skip_bytes(deserializer.deserialize_len());
+}
+
+void skip_bit_size(serde::BincodeDeserializer& deserializer)
+{
+    static_assert(std::is_same_v<std::variant_alternative_t<1, decltype(Program::BitSize::value)>,
+                                 Program::BitSize::Integer>);
+    if (read_variant_index<Program::BitSize>(deserializer) == 1) {
+        read_variant_index<Program::IntegerBitSize>(deserializer);
+    }
+}
+
+void skip_heap_value_type(serde::BincodeDeserializer& deserializer);
+
+void skip_heap_value_types(serde::BincodeDeserializer& deserializer)
+{
+    const size_t len = deserializer.deserialize_len();
+    for (size_t i = 0; i < len; ++i) {
+        skip_heap_value_type(deserializer);
+    }
+}
+
+void skip_heap_value_type(serde::BincodeDeserializer& deserializer)
+{
+    static_assert(std::variant_size_v<decltype(Program::HeapValueType::value)> == 3);
+    switch (read_variant_index<Program::HeapValueType>(deserializer)) {
+    case 0: // Simple { value }
+        skip_bit_size(deserializer);
+        break;
+    case 1: // Array { value_types, size }
+        skip_heap_value_types(deserializer);
+        deserializer.skip_bytes(sizeof(uint64_t));
+        break;
+    case 2: // Vector { value_types }
+        skip_heap_value_types(deserializer);
+        break;
+    }
+}
+
+void skip_value_or_arrays(serde::BincodeDeserializer& deserializer)
+{
+    static_assert(std::variant_size_v<decltype(Program::ValueOrArray::value)> == 3);
+    const size_t len = deserializer.deserialize_len();
+    for (size_t i = 0; i < len; ++i) {
+        // A MemoryAddress, or a HeapArray or HeapVector, which have the same size
+        static_assert(HEAP_ARRAY_SIZE == HEAP_VECTOR_SIZE);
+        const uint32_t index = read_variant_index<Program::ValueOrArray>(deserializer);
+        deserializer.skip_bytes(index == 0 ? MEMORY_ADDRESS_SIZE : HEAP_ARRAY_SIZE);
+    }
+}
+
+void skip_black_box_op(serde::BincodeDeserializer& deserializer)
+{
+    constexpr size_t MA = MEMORY_ADDRESS_SIZE;
+    constexpr size_t HA = HEAP_ARRAY_SIZE;
+    constexpr size_t HV = HEAP_VECTOR_SIZE;
+    // The size of the fields of each variant, in variant order
+    constexpr std::array<size_t, 22> variant_sizes = {
+        HV + HA + HA + HV,          // AES128Encrypt { inputs, iv, key, outputs }
+        HV + HA,                    // Sha256 { message, output }
+        HV + HA,                    // Blake2s { message, output }
+        HV + HA,                    // Blake3 { message, output }
+        HV + HA,                    // Keccak256 { message, output }
+        HV + HA,                    // Keccakf1600 { message, output }
+        HV + HA + HA + HA + MA,     // EcdsaSecp256k1 { hashed_msg, public_key_x, public_key_y, signature, result }
+        HV + HA + HA + HA + MA,     // EcdsaSecp256r1 { hashed_msg, public_key_x, public_key_y, signature, result }
+        MA + MA + HV + HV + MA,     // SchnorrVerify { public_key_x, public_key_y, message, signature, result }
+        HV + MA + HA,               // PedersenCommitment { inputs, domain_separator, output }
+        HV + MA + MA,               // PedersenHash { inputs, domain_separator, output }
+        HV + HV + HA,               // MultiScalarMul { points, scalars, outputs }
+        6 * MA + HA,                // EmbeddedCurveAdd { input1_x, ..., input2_infinite, result }
+        3 * MA,                     // BigIntAdd { lhs, rhs, output }
+        3 * MA,                     // BigIntSub { lhs, rhs, output }
+        3 * MA,                     // BigIntMul { lhs, rhs, output }
+        3 * MA,                     // BigIntDiv { lhs, rhs, output }
+        HV + HV + MA,               // BigIntFromLeBytes { inputs, modulus, output }
+        MA + HV,                    // BigIntToLeBytes { input, output }
+        HV + HA + MA,               // Poseidon2Permutation { message, output, len }
+        HV + HV + HA,               // Sha256Compression { input, hash_values, output }
+        MA + sizeof(uint32_t) + HA, // ToRadix { input, radix, output, output_bits }
+    };
+    using Variant = decltype(Program::BlackBoxOp::value);
+    static_assert(std::variant_size_v<Variant> == variant_sizes.size());
+    constexpr size_t TO_RADIX = variant_sizes.size() - 1;
+    static_assert(std::is_same_v<std::variant_alternative_t<TO_RADIX, Variant>, Program::BlackBoxOp::ToRadix>);
+
+    const uint32_t index = read_variant_index<Program::BlackBoxOp>(deserializer);
+    deserializer.skip_bytes(variant_sizes[index]);
+    if (index == TO_RADIX) {
+        deserializer.deserialize_bool(); // output_bits
+    }
+}
+
+void skip_brillig_opcode(serde::BincodeDeserializer& deserializer)
+{
+    constexpr size_t MA = MEMORY_ADDRESS_SIZE;
+    static_assert(std::variant_size_v<decltype(Program::BrilligOpcode::value)> == 19);
+    switch (read_variant_index<Program::BrilligOpcode>(deserializer)) {
+    case 0: // BinaryFieldOp { destination, op, lhs, rhs }
+        deserializer.skip_bytes(MA);
+        read_variant_index<Program::BinaryFieldOp>(deserializer);
+        deserializer.skip_bytes(2 * MA);
+        break;
+    case 1: // BinaryIntOp { destination, op, bit_size, lhs, rhs }
+        deserializer.skip_bytes(MA);
+        read_variant_index<Program::BinaryIntOp>(deserializer);
+        read_variant_index<Program::IntegerBitSize>(deserializer);
+        deserializer.skip_bytes(2 * MA);
+        break;
+    case 2: // Cast { destination, source, bit_size }
+        deserializer.skip_bytes(2 * MA);
+        skip_bit_size(deserializer);
+        break;
+    case 3: // JumpIfNot { condition, location }
+    case 4: // JumpIf { condition, location }
+        deserializer.skip_bytes(MA + sizeof(uint64_t));
+        break;
+    case 5: // Jump { location }
+        deserializer.skip_bytes(sizeof(uint64_t));
+        break;
+    case 6: // CalldataCopy { destination_address, size, offset }
+        deserializer.skip_bytes(MA + 2 * sizeof(uint64_t));
+        break;
+    case 7: // Call { location }
+        deserializer.skip_bytes(sizeof(uint64_t));
+        break;
+    case 8: // Const { destination, bit_size, value }
+    case 9: // IndirectConst { destination_pointer, bit_size, value }
+        deserializer.skip_bytes(MA);
+        skip_bit_size(deserializer);
+        skip_string(deserializer);
+        break;
+    case 10: // Return
+        break;
+    case 11: // ForeignCall { function, destinations, destination_value_types, inputs, input_value_types }
+        skip_string(deserializer);
+        skip_value_or_arrays(deserializer);
+        skip_heap_value_types(deserializer);
+        skip_value_or_arrays(deserializer);
+        skip_heap_value_types(deserializer);
+        break;
+    case 12: // Mov { destination, source }
+        deserializer.skip_bytes(2 * MA);
+        break;
+    case 13: // ConditionalMov { destination, source_a, source_b, condition }
+        deserializer.skip_bytes(4 * MA);
+        break;
+    case 14: // Load { destination, source_pointer }
+    case 15: // Store { destination_pointer, source }
+        deserializer.skip_bytes(2 * MA);
+        break;
+    case 16: // BlackBox { value }
+        skip_black_box_op(deserializer);
+        break;
+    case 17: // Trap { revert_data }
+        deserializer.skip_bytes(HEAP_ARRAY_SIZE);
+        break;
+    case 18: // Stop { return_data_offset, return_data_size }
+        deserializer.skip_bytes(2 * sizeof(uint64_t));
+        break;
+    }
+}
+
+// BrilligBytecode { bytecode }
+void skip_brillig_bytecode(serde::BincodeDeserializer& deserializer)
+{
+    const size_t num_opcodes = deserializer.deserialize_len();
+    for (size_t i = 0; i < num_opcodes; ++i) {
+        skip_brillig_opcode(deserializer);
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Incrementally decodes the ACIR functions of a serialized `Program::Program`
+ *
+ * @details A program is serialized as {functions: Vec<Circuit>, unconstrained_functions: Vec<BrilligBytecode>}.
+ * Rather than materialising the `Program` object graph, the circuits are read one at a time straight from the caller's
+ * buffer and each opcode is converted into the `AcirFormat` as soon as it is decoded, so only a single
+ * `Program::Opcode` is alive at a time. The unconstrained (Brillig) functions play no part in constraint generation;
+ * finish() steps over them without decoding them to check that the program spans the whole buffer.
+ */
+class ProgramCircuitReader {
+  public:
+    ProgramCircuitReader(std::span<const uint8_t> buf)
+        : deserializer(buf)
+        , buf_size(buf.size())
+    {
+        deserializer.increase_container_depth();
+        num_functions = deserializer.deserialize_len();
+    }
+
+    [[nodiscard]] size_t size() const { return num_functions; }
+
+    AcirFormat read_next(bool honk_recursion)
+    {
+        AcirFormat af;
+        BlockConstraintMap block_id_to_block_constraint;
+        read_circuit(af, [&](const Program::Opcode& opcode, size_t opcode_index) {
+            handle_opcode(opcode, af, block_id_to_block_constraint, honk_recursion, opcode_index);
+        });
+        add_block_constraints(af, block_id_to_block_constraint);
+        return af;
+    }
+
+    /**
+     * @brief Skip the functions that have not been read and check that the program spans the whole buffer
+     */
+    void finish()
+    {
+        while (num_read < num_functions) {
+            AcirFormat unused;
+            read_circuit(unused, [](const Program::Opcode& /*unused*/, size_t /*unused*/) {});
+        }
+        const size_t num_unconstrained_functions = deserializer.deserialize_len();
+        for (size_t i = 0; i < num_unconstrained_functions; ++i) {
+            skip_brillig_bytecode(deserializer);
+        }
+        deserializer.decrease_container_depth();
+        if (deserializer.get_buffer_offset() < buf_size) {
+            throw_or_abort("Some input bytes were not read");
+        }
+    }
+
+  private:
+    serde::BincodeDeserializer deserializer;
+    size_t buf_size;
+    size_t num_functions = 0;
+    size_t num_read = 0;
+
+    /**
+     * @brief Decode the next `Program::Circuit` field by field, as serde::Deserializable<Program::Circuit> does
+     * @details Each opcode is passed to on_opcode as soon as it is decoded; the other fields that matter for constraint
+     * generation are written to af.
+     */
+    template <typename OpcodeHandler> void read_circuit(AcirFormat& af, OpcodeHandler&& on_opcode)
+    {
+        if (num_read == num_functions) {
+            throw_or_abort("ACIR program does not contain any more functions");
+        }
+        ++num_read;
+        deserializer.increase_container_depth();
+        // `varnum` is the true number of variables, thus we add one to the index which starts at zero
+        af.varnum = serde::Deserializable<uint32_t>::deserialize(deserializer) + 1;
+        const size_t num_opcodes = deserializer.deserialize_len();
+        af.num_acir_opcodes = static_cast<uint32_t>(num_opcodes);
+        for (size_t i = 0; i < num_opcodes; ++i) {
+            on_opcode(serde::Deserializable<Program::Opcode>::deserialize(deserializer), i);
+        }
+        serde::Deserializable<Program::ExpressionWidth>::deserialize(deserializer);
+        serde::Deserializable<std::vector<Program::Witness>>::deserialize(deserializer); // private parameters
+        const auto public_parameters = serde::Deserializable<Program::PublicInputs>::deserialize(deserializer);
+        const auto return_values = serde::Deserializable<Program::PublicInputs>::deserialize(deserializer);
+        af.public_inputs = join({ map(public_parameters.value, [](auto e) { return e.value; }),
+                                  map(return_values.value, [](auto e) { return e.value; }) });
+        serde::Deserializable<decltype(Program::Circuit::assert_messages)>::deserialize(deserializer);
+        af.recursive = serde::Deserializable<bool>::deserialize(deserializer);
+        deserializer.decrease_container_depth();
+    }
+};
+
+AcirFormat circuit_buf_to_acir_format(std::span<const uint8_t> buf, bool honk_recursion)
 {
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/927): Move to using just
     // `program_buf_to_acir_format` once Honk fully supports all ACIR test flows For now the backend still expects
     // to work with a single ACIR function
-    auto circuit = Program::Program::bincodeDeserialize(buf).functions[0];
-
-    return circuit_serde_to_acir_format(circuit, honk_recursion);
+    ProgramCircuitReader reader(buf);
+    if (reader.size() == 0) {
+        throw_or_abort("ACIR program does not contain any functions");
+    }
+    AcirFormat constraint_system = reader.read_next(honk_recursion);
+    reader.finish();
+    return constraint_system;
 }
 
 /**
@@ -658,15 +965,16 @@ WitnessVector witness_buf_to_witness_data(std::vector<uint8_t> const& buf)
     return witness_map_to_witness_vector(w);
 }
 
-std::vector<AcirFormat> program_buf_to_acir_format(std::vector<uint8_t> const& buf, bool honk_recursion)
+std::vector<AcirFormat> program_buf_to_acir_format(std::span<const uint8_t> buf, bool honk_recursion)
 {
-    auto program = Program::Program::bincodeDeserialize(buf);
+    ProgramCircuitReader reader(buf);
 
     std::vector<AcirFormat> constraint_systems;
-    constraint_systems.reserve(program.functions.size());
-    for (auto const& function : program.functions) {
-        constraint_systems.emplace_back(circuit_serde_to_acir_format(function, honk_recursion));
+    constraint_systems.reserve(reader.size());
+    for (size_t i = 0; i < reader.size(); ++i) {
+        constraint_systems.emplace_back(reader.read_next(honk_recursion));
     }
+    reader.finish();
 
     return constraint_systems;
 }
@@ -1,10 +1,21 @@
 #pragma once
 #include "acir_format.hpp"
 #include "serde/index.hpp"
+#include <span>
 
 namespace acir_format {
 
-AcirFormat circuit_buf_to_acir_format(std::vector<uint8_t> const& buf, bool honk_recursion);
+/**
+ * @brief Converts a decoded ACIR function into an `AcirFormat`
+ */
+AcirFormat circuit_serde_to_acir_format(Program::Circuit const& circuit, bool honk_recursion);
+
+/**
+ * @brief Decodes the first function of a serialized ACIR program into an `AcirFormat`
+ * @details The bytecode is read in place. The other functions are only decoded to validate the buffer, one opcode at a
+ * time, and are not converted.
+ */
+AcirFormat circuit_buf_to_acir_format(std::span<const uint8_t> buf, bool honk_recursion);
 
 /**
  * @brief Converts from the ACIR-native `WitnessMap` format to Barretenberg's internal `WitnessVector` format.
@@ -16,7 +27,12 @@ AcirFormat circuit_buf_to_acir_format(std::vector<uint8_t> const& buf, bool honk
  */
 WitnessVector witness_buf_to_witness_data(std::vector<uint8_t> const& buf);
 
-std::vector<AcirFormat> program_buf_to_acir_format(std::vector<uint8_t> const& buf, bool honk_recursion);
+/**
+ * @brief Decodes every function of a serialized ACIR program into an `AcirFormat`
+ * @details Opcodes are decoded one at a time from the caller's buffer and converted before the next one is read, so
+ * neither the `Program::Program` object graph nor that of a single `Program::Circuit` is ever held in memory.
+ */
+std::vector<AcirFormat> program_buf_to_acir_format(std::span<const uint8_t> buf, bool honk_recursion);
 
 WitnessVectorStack witness_buf_to_witness_stack(std::vector<uint8_t> const& buf);
 
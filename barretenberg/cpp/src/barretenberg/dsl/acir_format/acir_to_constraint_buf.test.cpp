@@ -0,0 +1,212 @@
+#include "acir_to_constraint_buf.hpp"
+
+#include <array>
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+
+using namespace acir_format;
+
+namespace {
+
+std::string field_hex(uint64_t value)
+{
+    std::array<char, 17> low_limb{};
+    std::snprintf(low_limb.data(), low_limb.size(), "%016lx", static_cast<unsigned long>(value));
+    return std::string(48, '0') + low_limb.data();
+}
+
+// A circuit constraining value * w_0 + w_1 == w_2, with w_2 public
+Program::Circuit construct_circuit(uint64_t value)
+{
+    Program::Expression expression{
+        .mul_terms = {},
+        .linear_combinations = { { field_hex(value), Program::Witness{ 0 } },
+                                 { field_hex(1), Program::Witness{ 1 } },
+                                 { std::string(64, 'f'), Program::Witness{ 2 } } },
+        .q_c = field_hex(0),
+    };
+    return Program::Circuit{
+        .current_witness_index = 2,
+        .opcodes = { Program::Opcode{ Program::Opcode::AssertZero{ expression } } },
+        .expression_width = Program::ExpressionWidth{ Program::ExpressionWidth::Bounded{ 4 } },
+        .private_parameters = { Program::Witness{ 0 }, Program::Witness{ 1 } },
+        .public_parameters = Program::PublicInputs{ { Program::Witness{ 2 } } },
+        .return_values = Program::PublicInputs{ {} },
+        .assert_messages = {},
+        .recursive = false,
+    };
+}
+
+Program::Expression witness_expression(uint32_t witness)
+{
+    return Program::Expression{
+        .mul_terms = {},
+        .linear_combinations = { { field_hex(1), Program::Witness{ witness } } },
+        .q_c = field_hex(0),
+    };
+}
+
+// Adds a range constraint, a memory block that is read, a Brillig call and an assertion message to the circuit
+Program::Circuit construct_circuit_with_memory(uint64_t value)
+{
+    auto circuit = construct_circuit(value);
+    const Program::Expression read{ .mul_terms = {}, .linear_combinations = {}, .q_c = field_hex(0) };
+    circuit.opcodes.push_back({ Program::Opcode::BlackBoxFuncCall{ { Program::BlackBoxFuncCall::RANGE{
+        { .input = { Program::ConstantOrWitnessEnum::Witness{ { 0 } } }, .num_bits = 32 } } } } });
+    circuit.opcodes.push_back({ Program::Opcode::MemoryInit{
+        .block_id = { 0 }, .init = { { 0 }, { 1 } }, .block_type = { Program::BlockType::Memory{} } } });
+    circuit.opcodes.push_back({ Program::Opcode::MemoryOp{
+        .block_id = { 0 },
+        .op = { .operation = read, .index = witness_expression(1), .value = witness_expression(2) },
+        .predicate = std::nullopt } });
+    circuit.opcodes.push_back(
+        { Program::Opcode::BrilligCall{ .id = 0, .inputs = {}, .outputs = {}, .predicate = std::nullopt } });
+    circuit.assert_messages = { { { Program::OpcodeLocation::Acir{ 0 } },
+                                  { Program::AssertionPayload::StaticString{ "unreachable" } } } };
+    return circuit;
+}
+
+// Every Brillig opcode and every Brillig black box operation, with some operands of variable size
+std::vector<Program::BrilligOpcode> construct_every_brillig_opcode()
+{
+    using OpcodeVariant = decltype(Program::BrilligOpcode::value);
+    using BlackBoxVariant = decltype(Program::BlackBoxOp::value);
+    std::vector<Program::BrilligOpcode> opcodes;
+    [&]<size_t... Is>(std::index_sequence<Is...>) {
+        (opcodes.push_back({ std::variant_alternative_t<Is, OpcodeVariant>{} }), ...);
+    }(std::make_index_sequence<std::variant_size_v<OpcodeVariant>>{});
+    [&]<size_t... Is>(std::index_sequence<Is...>) {
+        using BlackBox = Program::BrilligOpcode::BlackBox;
+        (opcodes.push_back({ BlackBox{ { std::variant_alternative_t<Is, BlackBoxVariant>{} } } }), ...);
+    }(std::make_index_sequence<std::variant_size_v<BlackBoxVariant>>{});
+
+    const Program::BitSize u128{ Program::BitSize::Integer{ { Program::IntegerBitSize::U128{} } } };
+    const Program::HeapValueType field{ Program::HeapValueType::Simple{ { Program::BitSize::Field{} } } };
+    const Program::HeapValueType array{ Program::HeapValueType::Array{ .value_types = { field, field }, .size = 2 } };
+    opcodes.push_back({ Program::BrilligOpcode::BinaryIntOp{ .destination = { 1 },
+                                                             .op = { Program::BinaryIntOp::Shr{} },
+                                                             .bit_size = { Program::IntegerBitSize::U64{} } } });
+    opcodes.push_back({ Program::BrilligOpcode::Cast{ .destination = { 1 }, .source = { 2 }, .bit_size = u128 } });
+    opcodes.push_back({ Program::BrilligOpcode::Const{ .destination = { 1 }, .bit_size = u128, .value = "1234" } });
+    opcodes.push_back({ Program::BrilligOpcode::ForeignCall{
+        .function = "print",
+        .destinations = { { Program::ValueOrArray::MemoryAddress{ { 1 } } },
+                          { Program::ValueOrArray::HeapArray{ { { 2 }, 2 } } } },
+        .destination_value_types = { field, array },
+        .inputs = { { Program::ValueOrArray::HeapVector{ { { 3 }, { 4 } } } } },
+        .input_value_types = { { Program::HeapValueType::Vector{ .value_types = { array } } } } } });
+    opcodes.push_back({ Program::BrilligOpcode::BlackBox{ { Program::BlackBoxOp::ToRadix{ .output_bits = true } } } });
+    return opcodes;
+}
+
+void expect_same_constraint_system(const AcirFormat& lhs, const AcirFormat& rhs)
+{
+    EXPECT_EQ(lhs.varnum, rhs.varnum);
+    EXPECT_EQ(lhs.recursive, rhs.recursive);
+    EXPECT_EQ(lhs.num_acir_opcodes, rhs.num_acir_opcodes);
+    EXPECT_EQ(lhs.public_inputs, rhs.public_inputs);
+    EXPECT_EQ(lhs.poly_triple_constraints, rhs.poly_triple_constraints);
+    EXPECT_EQ(lhs.range_constraints, rhs.range_constraints);
+    ASSERT_EQ(lhs.block_constraints.size(), rhs.block_constraints.size());
+    for (size_t i = 0; i < lhs.block_constraints.size(); ++i) {
+        const auto& lhs_block = lhs.block_constraints[i];
+        const auto& rhs_block = rhs.block_constraints[i];
+        EXPECT_EQ(lhs_block.init, rhs_block.init);
+        EXPECT_EQ(lhs_block.type, rhs_block.type);
+        ASSERT_EQ(lhs_block.trace.size(), rhs_block.trace.size());
+        for (size_t j = 0; j < lhs_block.trace.size(); ++j) {
+            EXPECT_EQ(lhs_block.trace[j].access_type, rhs_block.trace[j].access_type);
+            EXPECT_EQ(lhs_block.trace[j].index, rhs_block.trace[j].index);
+            EXPECT_EQ(lhs_block.trace[j].value, rhs_block.trace[j].value);
+        }
+    }
+    EXPECT_EQ(lhs.original_opcode_indices, rhs.original_opcode_indices);
+}
+
+// Two ACIR functions and an unconstrained function, which sits at the end of the serialized program
+std::vector<uint8_t> construct_program_buf()
+{
+    Program::Program program{
+        .functions = { construct_circuit(2), construct_circuit(3) },
+        .unconstrained_functions = { Program::BrilligBytecode{
+            { Program::BrilligOpcode{ Program::BrilligOpcode::Return{} } } } },
+    };
+    return program.bincodeSerialize();
+}
+
+void expect_decoded_circuit(const AcirFormat& constraint_system, uint64_t value)
+{
+    EXPECT_EQ(constraint_system.varnum, 3);
+    EXPECT_EQ(constraint_system.public_inputs, std::vector<uint32_t>{ 2 });
+    ASSERT_EQ(constraint_system.poly_triple_constraints.size(), 1);
+    EXPECT_EQ(constraint_system.poly_triple_constraints[0].q_l, bb::fr(value));
+}
+
+} // namespace
+
+TEST(AcirToConstraintBuf, ProgramRoundTrip)
+{
+    const auto buf = construct_program_buf();
+
+    const auto constraint_systems = program_buf_to_acir_format(buf, /*honk_recursion=*/false);
+    ASSERT_EQ(constraint_systems.size(), 2);
+    expect_decoded_circuit(constraint_systems[0], 2);
+    expect_decoded_circuit(constraint_systems[1], 3);
+
+    expect_decoded_circuit(circuit_buf_to_acir_format(buf, /*honk_recursion=*/false), 2);
+}
+
+TEST(AcirToConstraintBuf, RejectTruncatedInput)
+{
+    const auto buf = construct_program_buf();
+    // Only the unconstrained function, which is not converted, is cut short
+    const std::vector<uint8_t> truncated(buf.begin(), buf.end() - 1);
+
+    EXPECT_THROW(program_buf_to_acir_format(truncated, /*honk_recursion=*/false), std::runtime_error);
+    EXPECT_THROW(circuit_buf_to_acir_format(truncated, /*honk_recursion=*/false), std::runtime_error);
+}
+
+TEST(AcirToConstraintBuf, RejectTrailingBytes)
+{
+    auto buf = construct_program_buf();
+    buf.push_back(0);
+
+    EXPECT_THROW(program_buf_to_acir_format(buf, /*honk_recursion=*/false), std::runtime_error);
+    EXPECT_THROW(circuit_buf_to_acir_format(buf, /*honk_recursion=*/false), std::runtime_error);
+}
+
+TEST(AcirToConstraintBuf, StreamedDecodingMatchesCircuitDecoding)
+{
+    const Program::Program program{
+        .functions = { construct_circuit_with_memory(2), construct_circuit_with_memory(3) },
+        .unconstrained_functions = { Program::BrilligBytecode{ construct_every_brillig_opcode() } },
+    };
+    const auto buf = program.bincodeSerialize();
+
+    const auto constraint_systems = program_buf_to_acir_format(buf, /*honk_recursion=*/false);
+    ASSERT_EQ(constraint_systems.size(), 2);
+    for (size_t i = 0; i < constraint_systems.size(); ++i) {
+        expect_same_constraint_system(constraint_systems[i],
+                                      circuit_serde_to_acir_format(program.functions[i], /*honk_recursion=*/false));
+    }
+    EXPECT_EQ(constraint_systems[0].block_constraints.size(), 1);
+    EXPECT_EQ(constraint_systems[0].range_constraints.size(), 1);
+}
+
+TEST(AcirToConstraintBuf, SkipEveryBrilligOpcode)
+{
+    for (const auto& opcode : construct_every_brillig_opcode()) {
+        // One opcode per program, so that an opcode that is skipped short cannot be made up for by another
+        const Program::Program program{
+            .functions = { construct_circuit(2) },
+            .unconstrained_functions = { Program::BrilligBytecode{ { opcode } } },
+        };
+        auto buf = program.bincodeSerialize();
+        EXPECT_NO_THROW(program_buf_to_acir_format(buf, /*honk_recursion=*/false));
+
+        buf.push_back(0);
+        EXPECT_THROW(program_buf_to_acir_format(buf, /*honk_recursion=*/false), std::runtime_error);
+    }
+}
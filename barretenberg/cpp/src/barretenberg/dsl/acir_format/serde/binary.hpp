@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <span>
 #include <variant>
 
 #include "serde.hpp"
@@ -54,14 +55,16 @@ template <class D> class BinaryDeserializer {
     size_t container_depth_budget_;
 
   protected:
-    std::vector<uint8_t> bytes_;
+    // The deserializer reads the caller's buffer in place rather than taking a copy of it; the buffer must outlive the
+    // deserializer.
+    std::span<const uint8_t> bytes_;
     uint8_t read_byte();
 
   public:
-    BinaryDeserializer(std::vector<uint8_t> bytes, size_t max_container_depth)
+    BinaryDeserializer(std::span<const uint8_t> bytes, size_t max_container_depth)
         : pos_(0)
         , container_depth_budget_(max_container_depth)
-        , bytes_(std::move(bytes))
+        , bytes_(bytes)
     {}
 
     std::string deserialize_str();
@@ -86,6 +89,8 @@ template <class D> class BinaryDeserializer {
 
     bool deserialize_option_tag();
 
+    void skip_bytes(size_t count);
+
     size_t get_buffer_offset();
     void increase_container_depth();
     void decrease_container_depth();
@@ -212,7 +217,15 @@ template <class D> uint8_t BinaryDeserializer<D>::read_byte()
     if (pos_ >= bytes_.size()) {
         throw_or_abort("Input is not large enough");
     }
-    return bytes_.at(pos_++);
+    return bytes_[pos_++];
+}
+
+template <class D> void BinaryDeserializer<D>::skip_bytes(size_t count)
+{
+    if (count > bytes_.size() - pos_) {
+        throw_or_abort("Input is not large enough");
+    }
+    pos_ += count;
 }
 
 inline bool is_valid_utf8(const std::string& input)
@@ -34,8 +34,8 @@ class BincodeDeserializer : public BinaryDeserializer<BincodeDeserializer> {
     using Parent = BinaryDeserializer<BincodeDeserializer>;
 
   public:
-    BincodeDeserializer(std::vector<uint8_t> bytes)
-        : Parent(std::move(bytes), SIZE_MAX)
+    BincodeDeserializer(std::span<const uint8_t> bytes)
+        : Parent(bytes, SIZE_MAX)
     {}
 
     float deserialize_f32();
@@ -0,0 +1,205 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/common/zip_view.hpp"
+#include "barretenberg/dsl/acir_format/acir_format.hpp"
+#include "barretenberg/sumcheck/instance/prover_instance.hpp"
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace acir_proofs {
+
+/**
+ * @brief A fixed ACIR program whose circuit structure is recorded on the first proof and reused for every later witness
+ *
+ * @details For a fixed program only the witness changes between proofs: the gates, the copy constraints, the selectors
+ * and the lookup tables are determined by the constraint system alone. The first prover instance created from a
+ * template is constructed as usual, after which the template records the structure of the circuit and keeps a shared
+ * handle on the precomputed polynomials (selectors, sigmas/ids, lookup tables, lagrange polynomials) of its proving
+ * key. Every later instance is obtained by
+ *  - re-executing the constraint system on the new witness into a builder presized from the recorded size profile;
+ *  - checking the circuit against the recorded structure before anything else is done with it;
+ *  - finalizing that builder, which recomputes the witness-dependent parts of the circuit, i.e. the sorted range lists
+ *    and the ordering of the RAM/ROM records;
+ *  - populating only the witness polynomials (wires, memory records, lookup read counts) of a proving key that shares
+ *    the recorded precomputed polynomials, so no selector is written and no copy cycle or permutation mapping is
+ *    computed.
+ *
+ * The constraint system itself cannot be skipped, since the stdlib gadgets compute the values of their intermediate
+ * witnesses while emitting their gates. The structure checked is a hash of every selector, of the copy cycle and tag
+ * of every wire and public input, and of the range lists, memory arrays and lookup tables from which finalization adds
+ * gates, so an instance is never paired with the precomputed polynomials of a differently shaped circuit (up to
+ * collisions of a non-cryptographic 64-bit hash, which only guards against programming errors). Computing it reads
+ * the circuit once, which is small against the permutation mapping it replaces.
+ */
+template <typename Flavor> class CircuitTemplate {
+  public:
+    using Builder = typename Flavor::CircuitBuilder;
+    using ProverInstance = bb::ProverInstance_<Flavor>;
+    using ProvingKey = typename Flavor::ProvingKey;
+    using CommitmentKey = typename Flavor::CommitmentKey;
+    using Polynomial = typename Flavor::Polynomial;
+
+    static_assert(std::same_as<Builder, bb::UltraCircuitBuilder>, "CircuitTemplate: unsupported flavor");
+
+    /**
+     * @brief The size profile of a circuit prior to finalization along with a hash of its structure
+     */
+    struct CircuitStructure {
+        bb::CircuitSizeProfile size_profile;
+        uint64_t hash = 0;
+
+        bool operator==(const CircuitStructure& other) const = default;
+    };
+
+    CircuitTemplate(acir_format::AcirFormat constraint_system, bool honk_recursion)
+        : constraint_system(std::move(constraint_system))
+        , honk_recursion(honk_recursion)
+    {}
+
+    bool is_recorded() const { return structure.has_value(); }
+
+    /**
+     * @brief Construct the circuit of the program for a witness, presizing its storage once a template is recorded
+     */
+    Builder create_circuit(const acir_format::WitnessVector& witness)
+    {
+        return acir_format::create_circuit<Builder>(constraint_system,
+                                                    /*size_hint=*/0,
+                                                    witness,
+                                                    honk_recursion,
+                                                    std::make_shared<bb::ECCOpQueue>(),
+                                                    /*collect_gates_per_opcode=*/false,
+                                                    size_profile);
+    }
+
+    /**
+     * @brief Construct a prover instance from a circuit of the program, recording the template on the first call
+     * @details The circuit must not have been finalized. Once the template is recorded, a circuit whose structure does
+     * not match it is rejected before any part of a proving key is constructed.
+     * @note The first instance constructs the commitment key, so the CRS must have been initialised beforehand.
+     */
+    std::shared_ptr<ProverInstance> create_prover_instance(Builder& builder)
+    {
+        ASSERT(!builder.circuit_finalized);
+        auto circuit_structure = compute_structure(builder);
+        if (!is_recorded()) {
+            auto instance = std::make_shared<ProverInstance>(builder);
+            record(std::move(circuit_structure), builder, instance->proving_key);
+            return instance;
+        }
+
+        if (circuit_structure != *structure) {
+            throw_or_abort("CircuitTemplate: the circuit does not match the recorded template");
+        }
+        return std::make_shared<ProverInstance>(builder, construct_proving_key());
+    }
+
+    std::shared_ptr<ProverInstance> create_prover_instance(const acir_format::WitnessVector& witness)
+    {
+        auto builder = create_circuit(witness);
+        return create_prover_instance(builder);
+    }
+
+    /**
+     * @brief Compute the structure of a circuit that has not been finalized
+     */
+    static CircuitStructure compute_structure(Builder& builder)
+    {
+        uint64_t hash = 0;
+        const auto mix = [&hash](uint64_t value) {
+            hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+        };
+        const auto mix_variable = [&](uint32_t variable_index) {
+            const uint32_t real_index = builder.real_variable_index[variable_index];
+            mix(real_index);
+            mix(builder.real_variable_tags[real_index]);
+        };
+
+        for (auto& block : builder.blocks.get()) {
+            mix(block.size());
+            for (auto& selector : block.selectors) {
+                for (const auto& value : selector) {
+                    for (const uint64_t limb : value.data) {
+                        mix(limb);
+                    }
+                }
+            }
+            for (auto& wire : block.wires) {
+                for (const uint32_t variable_index : wire) {
+                    mix_variable(variable_index);
+                }
+            }
+        }
+        for (const uint32_t variable_index : builder.public_inputs) {
+            mix_variable(variable_index);
+        }
+        for (const auto& [target_range, range_list] : builder.range_lists) {
+            mix(target_range);
+            for (const uint32_t variable_index : range_list.variable_indices) {
+                mix_variable(variable_index);
+            }
+        }
+        for (const auto& rom_array : builder.rom_arrays) {
+            mix(rom_array.state.size());
+            mix(rom_array.records.size());
+        }
+        for (const auto& ram_array : builder.ram_arrays) {
+            mix(ram_array.state.size());
+            mix(ram_array.records.size());
+        }
+        for (const auto& table : builder.lookup_tables) {
+            mix(static_cast<uint64_t>(table.id()));
+        }
+        return { builder.get_size_profile(), hash };
+    }
+
+  private:
+    acir_format::AcirFormat constraint_system;
+    bool honk_recursion;
+
+    // Recorded from the first circuit, before and after finalization respectively
+    std::optional<CircuitStructure> structure;
+    std::optional<bb::CircuitSizeProfile> size_profile;
+    size_t circuit_size = 0;
+    size_t num_public_inputs = 0;
+    std::shared_ptr<CommitmentKey> commitment_key;
+    std::vector<Polynomial> precomputed_polynomials;
+
+    void record(CircuitStructure&& circuit_structure, Builder& finalized_builder, ProvingKey& proving_key)
+    {
+        structure = std::move(circuit_structure);
+        size_profile = finalized_builder.get_size_profile();
+        circuit_size = proving_key.circuit_size;
+        num_public_inputs = proving_key.num_public_inputs;
+        commitment_key = proving_key.commitment_key;
+        // The prover never modifies the precomputed polynomials, so they can be shared with every later instance
+        for (auto& polynomial : proving_key.polynomials.get_precomputed()) {
+            precomputed_polynomials.emplace_back(polynomial.share());
+        }
+    }
+
+    /**
+     * @brief Construct a proving key whose precomputed polynomials alias the recorded ones and whose witness
+     * polynomials are freshly allocated
+     */
+    ProvingKey construct_proving_key() const
+    {
+        ProvingKey proving_key;
+        static_cast<typename ProvingKey::Base&>(proving_key) =
+            typename ProvingKey::Base(circuit_size, num_public_inputs, commitment_key);
+        for (auto& polynomial : proving_key.polynomials.get_witness()) {
+            polynomial = Polynomial(circuit_size);
+        }
+        for (auto [polynomial, precomputed] :
+             zip_view(proving_key.polynomials.get_precomputed(), precomputed_polynomials)) {
+            polynomial = precomputed.share();
+        }
+        proving_key.polynomials.set_shifted();
+        return proving_key;
+    }
+};
+
+} // namespace acir_proofs
@@ -0,0 +1,120 @@
+#include "circuit_template.hpp"
+#include "barretenberg/dsl/acir_format/acir_format_mocks.hpp"
+#include "barretenberg/ultra_honk/ultra_prover.hpp"
+#include "barretenberg/ultra_honk/ultra_verifier.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace bb;
+using namespace acir_format;
+
+class CircuitTemplateTests : public ::testing::Test {
+  protected:
+    using Flavor = UltraFlavor;
+    using VerificationKey = Flavor::VerificationKey;
+    using Template = acir_proofs::CircuitTemplate<Flavor>;
+
+    static void SetUpTestSuite() { srs::init_crs_factory("../srs_db/ignition"); }
+
+    /**
+     * @brief A program computing w2 = w0 * w1 with range constrained inputs, which also reads w4 from a RAM array
+     * initialised to [w0, w1] at the witness index w3
+     */
+    static AcirFormat construct_constraint_system()
+    {
+        poly_triple product{ .a = 0, .b = 1, .c = 2, .q_m = 1, .q_l = 0, .q_r = 0, .q_o = fr::neg_one(), .q_c = 0 };
+        auto witness = [](uint32_t index) {
+            return poly_triple{ .a = index, .b = 0, .c = 0, .q_m = 0, .q_l = 1, .q_r = 0, .q_o = 0, .q_c = 0 };
+        };
+        BlockConstraint ram{
+            .init = { witness(0), witness(1) },
+            .trace = { MemOp{ .access_type = 0, .index = witness(3), .value = witness(4) } },
+            .type = BlockType::RAM,
+        };
+
+        AcirFormat constraint_system{};
+        constraint_system.varnum = 5;
+        constraint_system.num_acir_opcodes = 4;
+        constraint_system.public_inputs = { 2 };
+        constraint_system.range_constraints = { { .witness = 0, .num_bits = 16 }, { .witness = 1, .num_bits = 16 } };
+        constraint_system.poly_triple_constraints.push_back(product);
+        constraint_system.block_constraints = { ram };
+        mock_opcode_indices(constraint_system);
+        return constraint_system;
+    }
+
+    static bool prove_and_verify(const std::shared_ptr<ProverInstance_<Flavor>>& instance,
+                                 const std::shared_ptr<VerificationKey>& verification_key)
+    {
+        UltraProver prover(instance);
+        auto proof = prover.construct_proof();
+        UltraVerifier verifier(verification_key);
+        return verifier.verify_proof(proof);
+    }
+};
+
+/**
+ * @brief Every witness proven through a template verifies against the verification key of the first one
+ * @details The two witnesses read different RAM entries, so the RAM record ordering differs between them
+ */
+TEST_F(CircuitTemplateTests, ReuseAcrossWitnesses)
+{
+    Template circuit_template(construct_constraint_system(), /*honk_recursion=*/false);
+    EXPECT_FALSE(circuit_template.is_recorded());
+
+    auto first_instance = circuit_template.create_prover_instance({ 5, 7, 35, 1, 7 });
+    EXPECT_TRUE(circuit_template.is_recorded());
+    auto verification_key = std::make_shared<VerificationKey>(first_instance->proving_key);
+    EXPECT_TRUE(prove_and_verify(first_instance, verification_key));
+
+    auto second_instance = circuit_template.create_prover_instance({ 11, 13, 143, 0, 11 });
+    for (auto [second, first] : zip_view(second_instance->proving_key.polynomials.get_precomputed(),
+                                         first_instance->proving_key.polynomials.get_precomputed())) {
+        EXPECT_EQ(second.data(), first.data());
+    }
+
+    // The instance must agree with one constructed from scratch for the same witness
+    auto constraint_system = construct_constraint_system();
+    auto reference_circuit = create_circuit(constraint_system, 0, { 11, 13, 143, 0, 11 });
+    ProverInstance_<Flavor> reference_instance(reference_circuit);
+    for (auto [instance_poly, reference_poly] : zip_view(second_instance->proving_key.polynomials.get_all(),
+                                                          reference_instance.proving_key.polynomials.get_all())) {
+        EXPECT_EQ(instance_poly, reference_poly);
+    }
+    EXPECT_TRUE(prove_and_verify(second_instance, verification_key));
+}
+
+/**
+ * @brief A circuit with the size profile of the template but different selectors or copy constraints is rejected
+ */
+TEST_F(CircuitTemplateTests, RejectDifferentlyShapedCircuit)
+{
+    Template circuit_template(construct_constraint_system(), /*honk_recursion=*/false);
+    const WitnessVector witness{ 5, 7, 35, 1, 7 };
+    auto recorded_circuit = circuit_template.create_circuit(witness);
+    const auto recorded_structure = Template::compute_structure(recorded_circuit);
+    circuit_template.create_prover_instance(recorded_circuit);
+
+    const auto expect_rejected = [&](AcirFormat constraint_system) {
+        auto circuit = create_circuit(constraint_system, 0, witness);
+        const auto structure = Template::compute_structure(circuit);
+        EXPECT_EQ(structure.size_profile, recorded_structure.size_profile);
+        EXPECT_NE(structure.hash, recorded_structure.hash);
+        EXPECT_THROW(circuit_template.create_prover_instance(circuit), std::runtime_error);
+    };
+
+    // A different constant in the product gate
+    auto constraint_system = construct_constraint_system();
+    constraint_system.poly_triple_constraints[0].q_c = 1;
+    expect_rejected(constraint_system);
+
+    // The same gate with its first input and its output swapped, i.e. different copy cycles
+    constraint_system = construct_constraint_system();
+    std::swap(constraint_system.poly_triple_constraints[0].a, constraint_system.poly_triple_constraints[0].c);
+    expect_rejected(constraint_system);
+
+    // The circuit of the template itself is accepted
+    auto circuit = circuit_template.create_circuit(witness);
+    EXPECT_EQ(Template::compute_structure(circuit), recorded_structure);
+    EXPECT_NO_THROW(circuit_template.create_prover_instance(circuit));
+}
@@ -0,0 +1,167 @@
+#pragma once
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include "barretenberg/honk/proof_system/proving_key_file.hpp"
+#include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_keccak.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <sstream>
+#include <unistd.h>
+
+namespace acir_proofs {
+
+/**
+ * @brief An on-disk cache of the witness-independent part of a Honk proving key and of its verification key
+ *
+ * @details For a fixed ACIR program only the witness changes between proofs, yet constructing a proving key recomputes
+ * the selectors, the sigma/id polynomials, the lookup tables and (for the verification key) the commitments to all of
+ * them. This cache stores those precomputed data keyed by the SHA-256 of the ACIR bytecode, the flavor and the
+ * recursion setting, so a repeated proof only has to populate the witness polynomials (see the `ProverInstance_`
+ * constructor taking a precomputed proving key).
+ *
+ * Each entry consists of two files in the cache directory:
+ *  - `<key>.pk`: the precomputed polynomials in the page-aligned `ProvingKeyFile` format, which is memory-mapped on
+ *    load rather than read and copied.
+ *  - `<key>.vk`: the serialized verification key, in the same format as written by `bb write_vk_ultra_honk`, followed
+ *    by its SHA-256 so that a truncated or corrupt file is detected before it is deserialized.
+ * Files are written under a temporary name and renamed into place, so a concurrent `bb` process never observes a
+ * partially written entry. Any entry that cannot be read is treated as a miss.
+ */
+template <typename Flavor> class HonkKeyCache {
+  public:
+    using ProvingKey = typename Flavor::ProvingKey;
+    using VerificationKey = typename Flavor::VerificationKey;
+    using FF = typename Flavor::FF;
+
+    // Bump whenever the layout of a cache entry, or the way the precomputed polynomials are constructed, changes
+    static constexpr uint32_t FORMAT_VERSION = 3;
+
+    HonkKeyCache(const std::filesystem::path& cache_dir, const std::vector<uint8_t>& bytecode, bool honk_recursion)
+        : cache_dir(cache_dir)
+    {
+        std::vector<uint8_t> preimage = bytecode;
+        std::string flavor = flavor_name();
+        preimage.insert(preimage.end(), flavor.begin(), flavor.end());
+        preimage.push_back(static_cast<uint8_t>(honk_recursion));
+        serialize::write(preimage, FORMAT_VERSION);
+
+        std::stringstream key_stream;
+        key_stream << bb::crypto::sha256(preimage);
+        key = key_stream.str();
+    }
+
+    const std::string& get_key() const { return key; }
+    std::filesystem::path proving_key_path() const { return cache_dir / (key + ".pk"); }
+    std::filesystem::path verification_key_path() const { return cache_dir / (key + ".vk"); }
+
+    /**
+     * @brief Map the cached precomputed polynomials into a fresh proving key, or return nullopt on a cache miss
+     * @note The proving key constructs its commitment key, so the CRS must have been initialised beforehand.
+     */
+    std::optional<ProvingKey> load_proving_key() const { return bb::ProvingKeyFile<Flavor>::read(proving_key_path()); }
+
+    /**
+     * @brief Load the cached verification key, or return nullptr on a cache miss
+     */
+    std::shared_ptr<VerificationKey> load_verification_key() const
+    {
+        std::ifstream is(verification_key_path(), std::ios::binary);
+        if (!is) {
+            return nullptr;
+        }
+        std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+        // from_buffer does not check bounds, so the key is only deserialized once its checksum matches
+        bb::crypto::Sha256Hash checksum;
+        if (buffer.size() <= checksum.size()) {
+            return nullptr;
+        }
+        std::copy(buffer.end() - static_cast<std::ptrdiff_t>(checksum.size()), buffer.end(), checksum.begin());
+        buffer.resize(buffer.size() - checksum.size());
+        if (bb::crypto::sha256(buffer) != checksum) {
+            return nullptr;
+        }
+        return std::make_shared<VerificationKey>(from_buffer<VerificationKey>(buffer));
+    }
+
+    /**
+     * @brief Load the cached verification key, or compute it from the proving key and write it to the cache
+     * @details Repairs an entry whose proving key was written but whose verification key was not, e.g. after a crash
+     * between the two writes of store().
+     */
+    std::shared_ptr<VerificationKey> load_or_store_verification_key(ProvingKey& proving_key) const
+    {
+        if (auto verification_key = load_verification_key()) {
+            return verification_key;
+        }
+        auto verification_key = std::make_shared<VerificationKey>(proving_key);
+        store_verification_key(*verification_key);
+        return verification_key;
+    }
+
+    /**
+     * @brief Write the precomputed polynomials of a proving key and the matching verification key to the cache
+     * @details Must be called before any witness-dependent proving work has modified the proving key; the
+     * precomputed polynomials are never modified by the prover, so in practice any time before proving is fine.
+     */
+    void store(ProvingKey& proving_key, const VerificationKey& verification_key) const
+    {
+        std::filesystem::create_directories(cache_dir);
+
+        atomic_write(proving_key_path(), [&](const std::filesystem::path& path) {
+            bb::ProvingKeyFile<Flavor>::write(path, proving_key);
+        });
+
+        store_verification_key(verification_key);
+    }
+
+    /**
+     * @brief Write a verification key to the cache
+     */
+    void store_verification_key(const VerificationKey& verification_key) const
+    {
+        std::filesystem::create_directories(cache_dir);
+        atomic_write(verification_key_path(), [&](const std::filesystem::path& path) {
+            std::ofstream os(path, std::ios::binary | std::ios::trunc);
+            auto buffer = to_buffer(verification_key);
+            const auto checksum = bb::crypto::sha256(buffer);
+            buffer.insert(buffer.end(), checksum.begin(), checksum.end());
+            os.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+            if (!os.good()) {
+                throw_or_abort("HonkKeyCache: failed to write " + path.string());
+            }
+        });
+    }
+
+  private:
+    std::filesystem::path cache_dir;
+    std::string key;
+
+    static constexpr const char* flavor_name()
+    {
+        if constexpr (std::same_as<Flavor, bb::UltraFlavor>) {
+            return "ultra_honk";
+        } else if constexpr (std::same_as<Flavor, bb::UltraKeccakFlavor>) {
+            return "ultra_keccak_honk";
+        } else {
+            static_assert(std::same_as<Flavor, bb::MegaFlavor>, "HonkKeyCache: unsupported flavor");
+            return "mega_honk";
+        }
+    }
+
+    static void atomic_write(const std::filesystem::path& path,
+                             const std::function<void(const std::filesystem::path&)>& write_file)
+    {
+        auto tmp_path = path;
+        tmp_path += ".tmp" + std::to_string(getpid());
+        write_file(tmp_path);
+        std::filesystem::rename(tmp_path, path);
+    }
+};
+
+} // namespace acir_proofs
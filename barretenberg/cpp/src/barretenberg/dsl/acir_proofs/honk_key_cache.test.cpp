@@ -0,0 +1,163 @@
+#include "honk_key_cache.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
+#include "barretenberg/ultra_honk/ultra_prover.hpp"
+#include "barretenberg/ultra_honk/ultra_verifier.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+class HonkKeyCacheTests : public ::testing::Test {
+  protected:
+    using Flavor = UltraFlavor;
+    using Builder = Flavor::CircuitBuilder;
+    using ProverInstance = ProverInstance_<Flavor>;
+    using Cache = acir_proofs::HonkKeyCache<Flavor>;
+
+    static void SetUpTestSuite() { srs::init_crs_factory("../srs_db/ignition"); }
+
+    void SetUp() override
+    {
+        cache_dir = std::filesystem::temp_directory_path() /
+                    ("honk_key_cache_test_" + std::to_string(getpid()) + "_" +
+                     ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(cache_dir);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(cache_dir); }
+
+    // Same circuit structure on every call, but with fresh random witness values
+    static Builder construct_circuit()
+    {
+        Builder builder;
+        MockCircuits::add_arithmetic_gates_with_public_inputs(builder, 10);
+        MockCircuits::add_lookup_gates(builder);
+        return builder;
+    }
+
+    std::filesystem::path cache_dir;
+    const std::vector<uint8_t> bytecode = { 1, 2, 3, 4 };
+};
+
+TEST_F(HonkKeyCacheTests, KeyDependsOnBytecodeAndRecursion)
+{
+    Cache cache(cache_dir, bytecode, false);
+    EXPECT_EQ(cache.get_key(), Cache(cache_dir, bytecode, false).get_key());
+    EXPECT_NE(cache.get_key(), Cache(cache_dir, bytecode, true).get_key());
+    EXPECT_NE(cache.get_key(), Cache(cache_dir, { 1, 2, 3, 5 }, false).get_key());
+    EXPECT_NE(cache.get_key(), acir_proofs::HonkKeyCache<UltraKeccakFlavor>(cache_dir, bytecode, false).get_key());
+}
+
+TEST_F(HonkKeyCacheTests, MissOnEmptyCache)
+{
+    Cache cache(cache_dir, bytecode, false);
+    EXPECT_FALSE(cache.load_proving_key().has_value());
+    EXPECT_EQ(cache.load_verification_key(), nullptr);
+}
+
+/**
+ * @brief Store the precomputed data of one circuit, then prove a second witness for the same circuit from the cache
+ */
+TEST_F(HonkKeyCacheTests, ProveFromCachedKey)
+{
+    Cache cache(cache_dir, bytecode, false);
+
+    auto first_circuit = construct_circuit();
+    auto first_instance = std::make_shared<ProverInstance>(first_circuit);
+    auto verification_key = std::make_shared<Flavor::VerificationKey>(first_instance->proving_key);
+    cache.store(first_instance->proving_key, *verification_key);
+
+    auto cached_proving_key = cache.load_proving_key();
+    ASSERT_TRUE(cached_proving_key.has_value());
+    auto cached_verification_key = cache.load_verification_key();
+    ASSERT_NE(cached_verification_key, nullptr);
+    EXPECT_EQ(cached_verification_key->circuit_size, verification_key->circuit_size);
+    for (auto [cached, computed] : zip_view(cached_verification_key->get_all(), verification_key->get_all())) {
+        EXPECT_EQ(cached, computed);
+    }
+
+    auto second_circuit = construct_circuit();
+    auto instance = std::make_shared<ProverInstance>(second_circuit, std::move(*cached_proving_key));
+
+    // The cached instance must agree with one constructed from scratch
+    auto reference_circuit = construct_circuit();
+    ProverInstance reference_instance(reference_circuit);
+    for (auto [cached, reference] :
+         zip_view(instance->proving_key.polynomials.get_precomputed(),
+                  reference_instance.proving_key.polynomials.get_precomputed())) {
+        EXPECT_EQ(cached, reference);
+    }
+    EXPECT_EQ(instance->proving_key.pub_inputs_offset, reference_instance.proving_key.pub_inputs_offset);
+    EXPECT_EQ(instance->proving_key.memory_read_records, reference_instance.proving_key.memory_read_records);
+
+    UltraProver prover(instance);
+    auto proof = prover.construct_proof();
+    cached_verification_key->pcs_verification_key = std::make_shared<VerifierCommitmentKey<curve::BN254>>();
+    UltraVerifier verifier(cached_verification_key);
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+
+/**
+ * @brief An entry whose verification key file is missing, e.g. after a crash between the two writes of store(), is
+ * repaired from the cached proving key
+ */
+TEST_F(HonkKeyCacheTests, RepairMissingVerificationKey)
+{
+    Cache cache(cache_dir, bytecode, false);
+
+    auto circuit = construct_circuit();
+    auto instance = std::make_shared<ProverInstance>(circuit);
+    auto verification_key = std::make_shared<Flavor::VerificationKey>(instance->proving_key);
+    cache.store(instance->proving_key, *verification_key);
+    std::filesystem::remove(cache.verification_key_path());
+    ASSERT_EQ(cache.load_verification_key(), nullptr);
+
+    // As in write_vk: the prover uses the cached proving key, the verification key is recomputed and written back
+    auto cached_proving_key = cache.load_proving_key();
+    ASSERT_TRUE(cached_proving_key.has_value());
+    auto second_circuit = construct_circuit();
+    auto cached_instance = std::make_shared<ProverInstance>(second_circuit, std::move(*cached_proving_key));
+    auto repaired_verification_key = cache.load_or_store_verification_key(cached_instance->proving_key);
+    ASSERT_NE(repaired_verification_key, nullptr);
+    auto reloaded_verification_key = cache.load_verification_key();
+    ASSERT_NE(reloaded_verification_key, nullptr);
+    EXPECT_EQ(to_buffer(*reloaded_verification_key), to_buffer(*verification_key));
+    EXPECT_EQ(to_buffer(*repaired_verification_key), to_buffer(*verification_key));
+}
+
+/**
+ * @brief A truncated or corrupt verification key file is a cache miss, and is repaired like a missing one
+ */
+TEST_F(HonkKeyCacheTests, CorruptVerificationKeyIsAMiss)
+{
+    Cache cache(cache_dir, bytecode, false);
+
+    auto circuit = construct_circuit();
+    auto instance = std::make_shared<ProverInstance>(circuit);
+    auto verification_key = std::make_shared<Flavor::VerificationKey>(instance->proving_key);
+    cache.store(instance->proving_key, *verification_key);
+    ASSERT_NE(cache.load_verification_key(), nullptr);
+    const auto file_size = std::filesystem::file_size(cache.verification_key_path());
+
+    std::filesystem::resize_file(cache.verification_key_path(), file_size / 2);
+    EXPECT_EQ(cache.load_verification_key(), nullptr);
+    std::filesystem::resize_file(cache.verification_key_path(), 1);
+    EXPECT_EQ(cache.load_verification_key(), nullptr);
+
+    cache.store_verification_key(*verification_key);
+    {
+        std::fstream file(cache.verification_key_path(), std::ios::binary | std::ios::in | std::ios::out);
+        const auto offset = static_cast<std::streamoff>(file_size / 3);
+        file.seekg(offset);
+        const auto byte = static_cast<char>(file.get() ^ 1);
+        file.seekp(offset);
+        file.put(byte);
+    }
+    EXPECT_EQ(cache.load_verification_key(), nullptr);
+
+    auto repaired_verification_key = cache.load_or_store_verification_key(instance->proving_key);
+    EXPECT_EQ(to_buffer(*repaired_verification_key), to_buffer(*verification_key));
+    auto reloaded_verification_key = cache.load_verification_key();
+    ASSERT_NE(reloaded_verification_key, nullptr);
+    EXPECT_EQ(to_buffer(*reloaded_verification_key), to_buffer(*verification_key));
+}
@@ -1,5 +1,6 @@
 #include "fr.hpp"
 #include <benchmark/benchmark.h>
+#include <vector>
 
 using namespace benchmark;
 
@@ -436,5 +437,76 @@ void pow_bench(State& state) noexcept
 }
 BENCHMARK(pow_bench);
 
+std::vector<fr> random_elements(const size_t num_elements)
+{
+    std::vector<fr> elements(num_elements);
+    for (auto& element : elements) {
+        element = fr::random_element();
+    }
+    return elements;
+}
+
+// Element-wise products of two spans, with the scalar multiplication and with fr::batch_mul (which uses the AVX-512
+// IFMA kernels when the CPU supports them). Throughput is reported per element.
+void scalar_batch_mul_bench(State& state) noexcept
+{
+    const auto num_elements = static_cast<size_t>(state.range(0));
+    const auto lhs = random_elements(num_elements);
+    const auto rhs = random_elements(num_elements);
+    std::vector<fr> result(num_elements);
+    for (auto _ : state) {
+        for (size_t i = 0; i < num_elements; ++i) {
+            result[i] = lhs[i] * rhs[i];
+        }
+        DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(scalar_batch_mul_bench)->RangeMultiplier(8)->Range(1 << 8, 1 << 20);
+
+void batch_mul_bench(State& state) noexcept
+{
+    const auto num_elements = static_cast<size_t>(state.range(0));
+    const auto lhs = random_elements(num_elements);
+    const auto rhs = random_elements(num_elements);
+    std::vector<fr> result(num_elements);
+    for (auto _ : state) {
+        fr::batch_mul(result, lhs, rhs);
+        DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(batch_mul_bench)->RangeMultiplier(8)->Range(1 << 8, 1 << 20);
+
+void scalar_batch_add_scaled_bench(State& state) noexcept
+{
+    const auto num_elements = static_cast<size_t>(state.range(0));
+    const auto other = random_elements(num_elements);
+    const fr scalar = fr::random_element();
+    auto result = random_elements(num_elements);
+    for (auto _ : state) {
+        for (size_t i = 0; i < num_elements; ++i) {
+            result[i] += scalar * other[i];
+        }
+        DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(scalar_batch_add_scaled_bench)->RangeMultiplier(8)->Range(1 << 8, 1 << 20);
+
+void batch_add_scaled_bench(State& state) noexcept
+{
+    const auto num_elements = static_cast<size_t>(state.range(0));
+    const auto other = random_elements(num_elements);
+    const fr scalar = fr::random_element();
+    auto result = random_elements(num_elements);
+    for (auto _ : state) {
+        fr::batch_add_scaled(result, other, scalar);
+        DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(batch_add_scaled_bench)->RangeMultiplier(8)->Range(1 << 8, 1 << 20);
+
 // NOLINTNEXTLINE macro invokation triggers style guideline errors from googletest code
 BENCHMARK_MAIN();
@@ -364,6 +364,69 @@ TEST(fr, BatchInvert)
     }
 }
 
+TEST(fr, ParallelBatchInvert)
+{
+    // Large enough to be split across threads, with zeroes that must be skipped in every chunk
+    const size_t n = (1 << 16) + 7;
+    std::vector<fr> coeffs(n);
+    for (size_t i = 0; i < n; ++i) {
+        coeffs[i] = (i % 1000 == 0) ? fr::zero() : fr::random_element();
+    }
+    std::vector<fr> inverses = coeffs;
+    fr::parallel_batch_invert(inverses);
+
+    for (size_t i = 0; i < n; ++i) {
+        if (coeffs[i].is_zero()) {
+            EXPECT_TRUE(inverses[i].is_zero());
+        } else {
+            EXPECT_EQ(coeffs[i] * inverses[i], fr::one());
+        }
+    }
+}
+
+/**
+ * @brief The batch operations agree with the scalar arithmetic, including on unreduced inputs in [p, 2p) and on a
+ * length that is not a multiple of the IFMA lane count
+ */
+TEST(fr, BatchMulAndAdd)
+{
+    const size_t n = 8 * 16 + 5;
+    const auto unreduced = [](const fr& x) {
+        const uint256_t value = uint256_t(x.data[0], x.data[1], x.data[2], x.data[3]) + fr::modulus;
+        fr result;
+        for (size_t i = 0; i < 4; ++i) {
+            result.data[i] = value.data[i];
+        }
+        return result;
+    };
+    std::vector<fr> lhs(n);
+    std::vector<fr> rhs(n);
+    std::vector<fr> accumulator(n);
+    for (size_t i = 0; i < n; ++i) {
+        lhs[i] = (i % 2 == 0) ? unreduced(fr::random_element()) : fr::random_element();
+        rhs[i] = (i % 3 == 0) ? unreduced(fr::random_element()) : fr::random_element();
+        accumulator[i] = (i % 5 == 0) ? unreduced(fr::random_element()) : fr::random_element();
+    }
+    rhs[1] = unreduced(fr::neg_one());
+    const fr scalar = fr::random_element();
+
+    std::vector<fr> products(n);
+    fr::batch_mul(products, lhs, rhs);
+    std::vector<fr> sums = accumulator;
+    fr::batch_mul_add(sums, lhs, rhs);
+    std::vector<fr> scaled_sums = accumulator;
+    fr::batch_add_scaled(scaled_sums, lhs, scalar);
+    std::vector<fr> scaled = lhs;
+    fr::batch_scale(scaled, scaled, scalar);
+
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(products[i], lhs[i] * rhs[i]);
+        EXPECT_EQ(sums[i], accumulator[i] + lhs[i] * rhs[i]);
+        EXPECT_EQ(scaled_sums[i], accumulator[i] + scalar * lhs[i]);
+        EXPECT_EQ(scaled[i], scalar * lhs[i]);
+    }
+}
+
 TEST(fr, MultiplicativeGenerator)
 {
     EXPECT_EQ(fr::multiplicative_generator(), fr(5));
@@ -302,6 +302,59 @@ TEST(g1, BatchNormalize)
     }
 }
 
+TEST(g1, BatchNormalizeWithInfinity)
+{
+    // Large enough to be split across threads
+    const size_t num_points = 2000;
+    std::vector<g1::element> points(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = (i % 100 == 0) ? g1::element::infinity()
+                                   : g1::element::random_element() + g1::element::random_element();
+    }
+    std::vector<g1::element> normalized = points;
+    g1::element::batch_normalize(normalized);
+
+    for (size_t i = 0; i < num_points; ++i) {
+        EXPECT_EQ(normalized[i].z, fq::one());
+        EXPECT_EQ(normalized[i].is_point_at_infinity(), points[i].is_point_at_infinity());
+        EXPECT_EQ(g1::affine_element(normalized[i]), g1::affine_element(points[i]));
+    }
+}
+
+TEST(g1, BatchAffineAddEdgeCases)
+{
+    const size_t num_points = 1000;
+    std::vector<g1::affine_element> lhs(num_points);
+    std::vector<g1::affine_element> rhs(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        lhs[i] = g1::affine_element(g1::element::random_element());
+        switch (i % 5) {
+        case 0: // doubling
+            rhs[i] = lhs[i];
+            break;
+        case 1: // P + (-P)
+            rhs[i] = -lhs[i];
+            break;
+        case 2:
+            rhs[i] = g1::affine_element::infinity();
+            break;
+        case 3:
+            lhs[i] = g1::affine_element::infinity();
+            rhs[i] = g1::affine_element(g1::element::random_element());
+            break;
+        default:
+            rhs[i] = g1::affine_element(g1::element::random_element());
+        }
+    }
+    std::vector<g1::affine_element> results(num_points);
+    g1::element::batch_affine_add(lhs, rhs, results);
+
+    for (size_t i = 0; i < num_points; ++i) {
+        const g1::affine_element expected(g1::element(lhs[i]) + g1::element(rhs[i]));
+        EXPECT_EQ(results[i], expected);
+    }
+}
+
 TEST(g1, GroupExponentiationCheckAgainstConstants)
 {
     fr a{ 0xb67299b792199cf0, 0xc1da7df1e7e12768, 0x692e427911532edf, 0x13dd85e87dc89978 };
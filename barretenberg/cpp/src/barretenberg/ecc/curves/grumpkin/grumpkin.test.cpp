@@ -225,6 +225,59 @@ TEST(grumpkin, BatchNormalize)
     }
 }
 
+TEST(grumpkin, BatchNormalizeWithInfinity)
+{
+    // Large enough to be split across threads
+    const size_t num_points = 2000;
+    std::vector<grumpkin::g1::element> points(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = (i % 100 == 0) ? grumpkin::g1::element::infinity()
+                                   : grumpkin::g1::element::random_element() + grumpkin::g1::element::random_element();
+    }
+    std::vector<grumpkin::g1::element> normalized = points;
+    grumpkin::g1::element::batch_normalize(normalized);
+
+    for (size_t i = 0; i < num_points; ++i) {
+        EXPECT_EQ(normalized[i].z, grumpkin::fq::one());
+        EXPECT_EQ(normalized[i].is_point_at_infinity(), points[i].is_point_at_infinity());
+        EXPECT_EQ(grumpkin::g1::affine_element(normalized[i]), grumpkin::g1::affine_element(points[i]));
+    }
+}
+
+TEST(grumpkin, BatchAffineAddEdgeCases)
+{
+    const size_t num_points = 1000;
+    std::vector<grumpkin::g1::affine_element> lhs(num_points);
+    std::vector<grumpkin::g1::affine_element> rhs(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        lhs[i] = grumpkin::g1::affine_element(grumpkin::g1::element::random_element());
+        switch (i % 5) {
+        case 0: // doubling
+            rhs[i] = lhs[i];
+            break;
+        case 1: // P + (-P)
+            rhs[i] = -lhs[i];
+            break;
+        case 2:
+            rhs[i] = grumpkin::g1::affine_element::infinity();
+            break;
+        case 3:
+            lhs[i] = grumpkin::g1::affine_element::infinity();
+            rhs[i] = grumpkin::g1::affine_element(grumpkin::g1::element::random_element());
+            break;
+        default:
+            rhs[i] = grumpkin::g1::affine_element(grumpkin::g1::element::random_element());
+        }
+    }
+    std::vector<grumpkin::g1::affine_element> results(num_points);
+    grumpkin::g1::element::batch_affine_add(lhs, rhs, results);
+
+    for (size_t i = 0; i < num_points; ++i) {
+        const grumpkin::g1::affine_element expected(grumpkin::g1::element(lhs[i]) + grumpkin::g1::element(rhs[i]));
+        EXPECT_EQ(results[i], expected);
+    }
+}
+
 TEST(grumpkin, GroupExponentiationZeroAndOne)
 {
     grumpkin::g1::affine_element result = grumpkin::g1::one * grumpkin::fr::zero();
@@ -325,6 +325,13 @@ template <class Params_> struct alignas(32) field {
     constexpr field invert() const noexcept;
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, size_t n) noexcept;
+    static void parallel_batch_invert(std::span<field> coeffs) noexcept;
+    static void batch_mul(std::span<field> result, std::span<const field> lhs, std::span<const field> rhs) noexcept;
+    static void batch_mul_add(std::span<field> result,
+                              std::span<const field> lhs,
+                              std::span<const field> rhs) noexcept;
+    static void batch_add_scaled(std::span<field> result, std::span<const field> other, const field& scalar) noexcept;
+    static void batch_scale(std::span<field> result, std::span<const field> other, const field& scalar) noexcept;
     /**
      * @brief Compute square root of the field element.
      *
@@ -0,0 +1,247 @@
+#include "field_ifma.hpp"
+
+#if BB_FIELD_IFMA
+#include <immintrin.h>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-bounds-constant-array-index)
+namespace bb::field_ifma {
+
+#define BB_TARGET_IFMA __attribute__((target("avx512f,avx512ifma")))
+
+namespace {
+
+using Vec = __m512i;
+using Limbs = std::array<Vec, NUM_LIMBS>;
+
+struct VecModulus {
+    Limbs p;
+    Limbs two_p;
+    Vec inverse;
+};
+
+BB_TARGET_IFMA inline VecModulus broadcast(const Modulus& modulus)
+{
+    VecModulus result;
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        result.p[i] = _mm512_set1_epi64(static_cast<int64_t>(modulus.p[i]));
+        result.two_p[i] = _mm512_set1_epi64(static_cast<int64_t>(modulus.two_p[i]));
+    }
+    result.inverse = _mm512_set1_epi64(static_cast<int64_t>(modulus.inverse));
+    return result;
+}
+
+BB_TARGET_IFMA inline Limbs broadcast_scalar(const uint64_t* scalar)
+{
+    const auto scalar_limbs = split_into_limbs({ scalar[0], scalar[1], scalar[2], scalar[3] });
+    Limbs result;
+    for (size_t j = 0; j < NUM_LIMBS; ++j) {
+        result[j] = _mm512_set1_epi64(static_cast<int64_t>(scalar_limbs[j]));
+    }
+    return result;
+}
+
+/**
+ * @brief Load 8 consecutive field elements and transpose them into one register per 64-bit limb
+ */
+BB_TARGET_IFMA inline std::array<Vec, 4> load_transposed(const uint64_t* src)
+{
+    const Vec z0 = _mm512_loadu_si512(src);
+    const Vec z1 = _mm512_loadu_si512(src + 8);
+    const Vec z2 = _mm512_loadu_si512(src + 16);
+    const Vec z3 = _mm512_loadu_si512(src + 24);
+    // Interleave limbs 0/1 and 2/3 of 4 elements, then gather the halves of all 8 elements
+    const Vec idx_01 = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const Vec idx_23 = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    const Vec idx_lo = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    const Vec idx_hi = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+    const Vec a01 = _mm512_permutex2var_epi64(z0, idx_01, z1);
+    const Vec a23 = _mm512_permutex2var_epi64(z0, idx_23, z1);
+    const Vec b01 = _mm512_permutex2var_epi64(z2, idx_01, z3);
+    const Vec b23 = _mm512_permutex2var_epi64(z2, idx_23, z3);
+    return { _mm512_permutex2var_epi64(a01, idx_lo, b01),
+             _mm512_permutex2var_epi64(a01, idx_hi, b01),
+             _mm512_permutex2var_epi64(a23, idx_lo, b23),
+             _mm512_permutex2var_epi64(a23, idx_hi, b23) };
+}
+
+/**
+ * @brief Inverse of load_transposed
+ */
+BB_TARGET_IFMA inline void store_transposed(uint64_t* dst, const std::array<Vec, 4>& d)
+{
+    const Vec idx_lo = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    const Vec idx_hi = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+    const Vec idx_01 = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const Vec idx_23 = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    const Vec a01 = _mm512_permutex2var_epi64(d[0], idx_lo, d[1]);
+    const Vec b01 = _mm512_permutex2var_epi64(d[0], idx_hi, d[1]);
+    const Vec a23 = _mm512_permutex2var_epi64(d[2], idx_lo, d[3]);
+    const Vec b23 = _mm512_permutex2var_epi64(d[2], idx_hi, d[3]);
+    _mm512_storeu_si512(dst, _mm512_permutex2var_epi64(a01, idx_01, a23));
+    _mm512_storeu_si512(dst + 8, _mm512_permutex2var_epi64(a01, idx_23, a23));
+    _mm512_storeu_si512(dst + 16, _mm512_permutex2var_epi64(b01, idx_01, b23));
+    _mm512_storeu_si512(dst + 24, _mm512_permutex2var_epi64(b01, idx_23, b23));
+}
+
+/**
+ * @brief Split 64-bit limbs into 52-bit limbs, optionally multiplying the value by 2^4
+ */
+template <bool shift_by_4> BB_TARGET_IFMA inline Limbs to_limbs(const std::array<Vec, 4>& d)
+{
+    const Vec mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    constexpr unsigned s = shift_by_4 ? 4 : 0;
+    return { _mm512_and_si512(_mm512_slli_epi64(d[0], s), mask),
+             _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(d[0], 52 - s), _mm512_slli_epi64(d[1], 12 + s)), mask),
+             _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(d[1], 40 - s), _mm512_slli_epi64(d[2], 24 + s)), mask),
+             _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(d[2], 28 - s), _mm512_slli_epi64(d[3], 36 + s)), mask),
+             _mm512_srli_epi64(d[3], 16 - s) };
+}
+
+BB_TARGET_IFMA inline std::array<Vec, 4> from_limbs(const Limbs& l)
+{
+    return { _mm512_or_si512(l[0], _mm512_slli_epi64(l[1], 52)),
+             _mm512_or_si512(_mm512_srli_epi64(l[1], 12), _mm512_slli_epi64(l[2], 40)),
+             _mm512_or_si512(_mm512_srli_epi64(l[2], 24), _mm512_slli_epi64(l[3], 28)),
+             _mm512_or_si512(_mm512_srli_epi64(l[3], 36), _mm512_slli_epi64(l[4], 16)) };
+}
+
+/**
+ * @brief Montgomery product a * b * 2^{-260} with unnormalised limbs (each limb may exceed 52 bits)
+ * @details Operand scanning: for each limb of b, accumulate a * b_i, then add the multiple of p that clears the lowest
+ * limb and shift down by one limb. The accumulators never exceed 2^58, well within the 64-bit lanes.
+ */
+BB_TARGET_IFMA inline Limbs montgomery_mul(const Limbs& a, const Limbs& b, const VecModulus& modulus)
+{
+    const Vec zero = _mm512_setzero_si512();
+    std::array<Vec, NUM_LIMBS + 1> t{ zero, zero, zero, zero, zero, zero };
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            t[j] = _mm512_madd52lo_epu64(t[j], a[j], b[i]);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], a[j], b[i]);
+        }
+        // Only the low 52 bits of t[0] are used by the multiplication, which is all that m depends on
+        const Vec m = _mm512_madd52lo_epu64(zero, t[0], modulus.inverse);
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            t[j] = _mm512_madd52lo_epu64(t[j], modulus.p[j], m);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], modulus.p[j], m);
+        }
+        // The low 52 bits of t[0] are now zero
+        t[1] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], 52));
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            t[j] = t[j + 1];
+        }
+        t[NUM_LIMBS] = zero;
+    }
+    return { t[0], t[1], t[2], t[3], t[4] };
+}
+
+BB_TARGET_IFMA inline Limbs add(const Limbs& a, const Limbs& b)
+{
+    Limbs result;
+    for (size_t j = 0; j < NUM_LIMBS; ++j) {
+        result[j] = _mm512_add_epi64(a[j], b[j]);
+    }
+    return result;
+}
+
+BB_TARGET_IFMA inline void normalize(Limbs& x)
+{
+    const Vec mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    for (size_t j = 0; j < NUM_LIMBS - 1; ++j) {
+        x[j + 1] = _mm512_add_epi64(x[j + 1], _mm512_srli_epi64(x[j], 52));
+        x[j] = _mm512_and_si512(x[j], mask);
+    }
+}
+
+/**
+ * @brief Subtract q from the lanes of the normalised value x that are at least q
+ */
+BB_TARGET_IFMA inline void conditional_subtract(Limbs& x, const Limbs& q)
+{
+    const Vec mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    Vec borrow = _mm512_setzero_si512();
+    Limbs difference;
+    for (size_t j = 0; j < NUM_LIMBS; ++j) {
+        const Vec d = _mm512_sub_epi64(_mm512_sub_epi64(x[j], q[j]), borrow);
+        borrow = _mm512_srli_epi64(d, 63);
+        difference[j] = _mm512_and_si512(d, mask);
+    }
+    const __mmask8 is_smaller = _mm512_test_epi64_mask(borrow, borrow);
+    for (size_t j = 0; j < NUM_LIMBS; ++j) {
+        x[j] = _mm512_mask_blend_epi64(is_smaller, difference[j], x[j]);
+    }
+}
+
+} // namespace
+
+bool is_supported()
+{
+    static const bool supported = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+    return supported;
+}
+
+BB_TARGET_IFMA void mul(
+    uint64_t* result, const uint64_t* lhs, const uint64_t* rhs, const size_t num_elements, const Modulus& modulus)
+{
+    const VecModulus vec_modulus = broadcast(modulus);
+    for (size_t i = 0; i < num_elements; i += NUM_LANES) {
+        const Limbs a = to_limbs<true>(load_transposed(lhs + 4 * i));
+        const Limbs b = to_limbs<false>(load_transposed(rhs + 4 * i));
+        // a < 32p and b < 2p, so the product is smaller than 2p
+        Limbs x = montgomery_mul(a, b, vec_modulus);
+        normalize(x);
+        conditional_subtract(x, vec_modulus.p);
+        store_transposed(result + 4 * i, from_limbs(x));
+    }
+}
+
+BB_TARGET_IFMA void mul_add(
+    uint64_t* result, const uint64_t* lhs, const uint64_t* rhs, const size_t num_elements, const Modulus& modulus)
+{
+    const VecModulus vec_modulus = broadcast(modulus);
+    for (size_t i = 0; i < num_elements; i += NUM_LANES) {
+        const Limbs a = to_limbs<true>(load_transposed(lhs + 4 * i));
+        const Limbs b = to_limbs<false>(load_transposed(rhs + 4 * i));
+        const Limbs c = to_limbs<false>(load_transposed(result + 4 * i));
+        // The product and the accumulator are both smaller than 2p
+        Limbs x = add(montgomery_mul(a, b, vec_modulus), c);
+        normalize(x);
+        conditional_subtract(x, vec_modulus.two_p);
+        conditional_subtract(x, vec_modulus.p);
+        store_transposed(result + 4 * i, from_limbs(x));
+    }
+}
+
+BB_TARGET_IFMA void add_scaled(
+    uint64_t* result, const uint64_t* other, const uint64_t* scalar, const size_t num_elements, const Modulus& modulus)
+{
+    const VecModulus vec_modulus = broadcast(modulus);
+    const Limbs b = broadcast_scalar(scalar);
+    for (size_t i = 0; i < num_elements; i += NUM_LANES) {
+        const Limbs a = to_limbs<true>(load_transposed(other + 4 * i));
+        const Limbs c = to_limbs<false>(load_transposed(result + 4 * i));
+        Limbs x = add(montgomery_mul(a, b, vec_modulus), c);
+        normalize(x);
+        conditional_subtract(x, vec_modulus.two_p);
+        conditional_subtract(x, vec_modulus.p);
+        store_transposed(result + 4 * i, from_limbs(x));
+    }
+}
+
+BB_TARGET_IFMA void scale(
+    uint64_t* result, const uint64_t* other, const uint64_t* scalar, const size_t num_elements, const Modulus& modulus)
+{
+    const VecModulus vec_modulus = broadcast(modulus);
+    const Limbs b = broadcast_scalar(scalar);
+    for (size_t i = 0; i < num_elements; i += NUM_LANES) {
+        const Limbs a = to_limbs<true>(load_transposed(other + 4 * i));
+        Limbs x = montgomery_mul(a, b, vec_modulus);
+        normalize(x);
+        conditional_subtract(x, vec_modulus.p);
+        store_transposed(result + 4 * i, from_limbs(x));
+    }
+}
+
+} // namespace bb::field_ifma
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-bounds-constant-array-index)
+#endif
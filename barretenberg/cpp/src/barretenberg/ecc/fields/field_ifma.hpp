@@ -0,0 +1,86 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// The AVX-512 IFMA kernels are compiled with per-function target attributes and selected at runtime, so the rest of
+// the library does not need to be built for AVX-512
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(__wasm__) && !defined(DISABLE_ASM)
+#define BB_FIELD_IFMA 1
+#else
+#define BB_FIELD_IFMA 0
+#endif
+
+/**
+ * @brief Element-wise Montgomery arithmetic over spans of field elements, 8 elements at a time, using AVX-512 IFMA
+ *
+ * @details Each 512-bit register holds one 52-bit limb of 8 field elements, so an element is split into 5 limbs and
+ * the products of limbs are accumulated with the 52-bit multiply-add instructions (vpmadd52luq/vpmadd52huq). The
+ * Montgomery reduction consumes 52 bits per limb, i.e. it divides by 2^260 rather than by the 2^256 of the scalar
+ * implementation. The difference is compensated for by shifting one of the operands left by 4 bits while it is split
+ * into limbs, so the results are in the same Montgomery form as the scalar ones.
+ *
+ * The kernels require the modulus to be smaller than 2^254 (true for the BN254 base and scalar fields), accept inputs
+ * in the range [0, 2p) and produce fully reduced outputs. They operate on a multiple of 8 elements; the callers in
+ * field_impl.hpp handle the remainder with the scalar arithmetic.
+ */
+namespace bb::field_ifma {
+
+static constexpr size_t NUM_LANES = 8;
+static constexpr size_t NUM_LIMBS = 5;
+static constexpr uint64_t LIMB_MASK = (1ULL << 52) - 1;
+
+struct Modulus {
+    std::array<uint64_t, NUM_LIMBS> p;
+    std::array<uint64_t, NUM_LIMBS> two_p;
+    uint64_t inverse; // -p^{-1} mod 2^52
+};
+
+constexpr std::array<uint64_t, NUM_LIMBS> split_into_limbs(const std::array<uint64_t, 4>& value)
+{
+    return { value[0] & LIMB_MASK,
+             ((value[0] >> 52) | (value[1] << 12)) & LIMB_MASK,
+             ((value[1] >> 40) | (value[2] << 24)) & LIMB_MASK,
+             ((value[2] >> 28) | (value[3] << 36)) & LIMB_MASK,
+             value[3] >> 16 };
+}
+
+// The limb arithmetic leaves no headroom for moduli of 254 bits or more
+template <typename Params> constexpr bool is_compatible = Params::modulus_3 < 0x4000000000000000ULL;
+
+template <typename Params> constexpr Modulus get_modulus()
+{
+    static_assert(is_compatible<Params>);
+    const std::array<uint64_t, 4> p{ Params::modulus_0, Params::modulus_1, Params::modulus_2, Params::modulus_3 };
+    const std::array<uint64_t, 4> two_p{ p[0] << 1,
+                                         (p[1] << 1) | (p[0] >> 63),
+                                         (p[2] << 1) | (p[1] >> 63),
+                                         (p[3] << 1) | (p[2] >> 63) };
+    // r_inv = -p^{-1} mod 2^64, so its low 52 bits are -p^{-1} mod 2^52
+    return { split_into_limbs(p), split_into_limbs(two_p), Params::r_inv & LIMB_MASK };
+}
+
+#if BB_FIELD_IFMA
+/**
+ * @brief Whether the CPU supports AVX-512 IFMA (detected once)
+ */
+bool is_supported();
+
+// result[i] = lhs[i] * rhs[i]
+void mul(uint64_t* result, const uint64_t* lhs, const uint64_t* rhs, size_t num_elements, const Modulus& modulus);
+// result[i] += lhs[i] * rhs[i]
+void mul_add(uint64_t* result, const uint64_t* lhs, const uint64_t* rhs, size_t num_elements, const Modulus& modulus);
+// result[i] += scalar * other[i]
+void add_scaled(
+    uint64_t* result, const uint64_t* other, const uint64_t* scalar, size_t num_elements, const Modulus& modulus);
+// result[i] = scalar * other[i]
+void scale(
+    uint64_t* result, const uint64_t* other, const uint64_t* scalar, size_t num_elements, const Modulus& modulus);
+#else
+inline bool is_supported()
+{
+    return false;
+}
+#endif
+
+} // namespace bb::field_ifma
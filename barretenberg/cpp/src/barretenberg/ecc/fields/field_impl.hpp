@@ -1,15 +1,18 @@
 #pragma once
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
+#include <algorithm>
 #include <memory>
 #include <span>
 #include <type_traits>
 #include <vector>
 
 #include "./field_declarations.hpp"
+#include "./field_ifma.hpp"
 
 namespace bb {
 
@@ -407,44 +410,33 @@ template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
 {
     BB_OP_COUNT_TRACK_NAME("fr::batch_invert");
     const size_t n = coeffs.size();
+    if (n == 0) {
+        return;
+    }
 
     auto temporaries_ptr = std::static_pointer_cast<field[]>(get_mem_slab(n * sizeof(field)));
-    auto skipped_ptr = std::static_pointer_cast<bool[]>(get_mem_slab(n));
+    // One bit per element marking the zero elements, which are skipped
+    const size_t num_skipped_words = (n + 63) / 64;
+    auto skipped_ptr = std::static_pointer_cast<uint64_t[]>(get_mem_slab(num_skipped_words * sizeof(uint64_t)));
     auto temporaries = temporaries_ptr.get();
     auto* skipped = skipped_ptr.get();
+    std::fill_n(skipped, num_skipped_words, 0);
 
     field accumulator = one();
     for (size_t i = 0; i < n; ++i) {
         temporaries[i] = accumulator;
         if (coeffs[i].is_zero()) {
-            skipped[i] = true;
+            skipped[i >> 6] |= 1ULL << (i & 63);
         } else {
-            skipped[i] = false;
             accumulator *= coeffs[i];
         }
     }
 
-    // std::vector<field> temporaries;
-    // std::vector<bool> skipped;
-    // temporaries.reserve(n);
-    // skipped.reserve(n);
-
-    // field accumulator = one();
-    // for (size_t i = 0; i < n; ++i) {
-    //     temporaries.emplace_back(accumulator);
-    //     if (coeffs[i].is_zero()) {
-    //         skipped.emplace_back(true);
-    //     } else {
-    //         skipped.emplace_back(false);
-    //         accumulator *= coeffs[i];
-    //     }
-    // }
-
     accumulator = accumulator.invert();
 
     field T0;
     for (size_t i = n - 1; i < n; --i) {
-        if (!skipped[i]) {
+        if (((skipped[i >> 6] >> (i & 63)) & 1) == 0) {
             T0 = accumulator * temporaries[i];
             accumulator *= coeffs[i];
             coeffs[i] = T0;
@@ -452,6 +444,131 @@ template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
     }
 }
 
+/**
+ * @brief Invert every non-zero element of a span in place, splitting the work across threads
+ * @details The span is divided into one contiguous chunk per thread and each chunk is batch inverted independently,
+ * i.e. the work costs one inversion per chunk on top of the 3 multiplications per element. Spans too small to amortise
+ * starting the threads are inverted serially. Zero elements are left unchanged, as in batch_invert.
+ */
+template <class T> void field<T>::parallel_batch_invert(std::span<field> coeffs) noexcept
+{
+    // Roughly the size at which one inversion per chunk and starting the threads stop dominating, see basics_bench
+    constexpr size_t MIN_ELEMENTS_PER_THREAD = 1 << 12;
+    const size_t n = coeffs.size();
+    const size_t num_threads = bb::calculate_num_threads(n, MIN_ELEMENTS_PER_THREAD);
+    if (num_threads <= 1) {
+        batch_invert(coeffs);
+        return;
+    }
+    const size_t chunk_size = (n + num_threads - 1) / num_threads;
+    bb::parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * chunk_size;
+        const size_t end = std::min(start + chunk_size, n);
+        if (start < end) {
+            batch_invert(coeffs.subspan(start, end - start));
+        }
+    });
+}
+
+/**
+ * @brief The number of leading elements of a batch operation to be computed by the AVX-512 IFMA kernels, see
+ * field_ifma.hpp. Zero if the kernels do not apply to this field or are not supported by the CPU.
+ */
+template <class T> size_t num_ifma_elements([[maybe_unused]] const size_t n) noexcept
+{
+    if constexpr (field_ifma::is_compatible<T>) {
+        if (field_ifma::is_supported()) {
+            return n - (n % field_ifma::NUM_LANES);
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Compute result[i] = lhs[i] * rhs[i]
+ * @details Uses the 8-lane AVX-512 IFMA kernels when the CPU supports them and the scalar multiplication otherwise.
+ */
+template <class T>
+void field<T>::batch_mul(std::span<field> result, std::span<const field> lhs, std::span<const field> rhs) noexcept
+{
+    ASSERT(lhs.size() == result.size() && rhs.size() == result.size());
+    const size_t num_vectorized = num_ifma_elements<T>(result.size());
+#if BB_FIELD_IFMA
+    if constexpr (field_ifma::is_compatible<T>) {
+        static constexpr field_ifma::Modulus modulus = field_ifma::get_modulus<T>();
+        if (num_vectorized > 0) {
+            field_ifma::mul(result.data()->data, lhs.data()->data, rhs.data()->data, num_vectorized, modulus);
+        }
+    }
+#endif
+    for (size_t i = num_vectorized; i < result.size(); ++i) {
+        result[i] = lhs[i] * rhs[i];
+    }
+}
+
+/**
+ * @brief Compute result[i] += lhs[i] * rhs[i]
+ */
+template <class T>
+void field<T>::batch_mul_add(std::span<field> result, std::span<const field> lhs, std::span<const field> rhs) noexcept
+{
+    ASSERT(lhs.size() == result.size() && rhs.size() == result.size());
+    const size_t num_vectorized = num_ifma_elements<T>(result.size());
+#if BB_FIELD_IFMA
+    if constexpr (field_ifma::is_compatible<T>) {
+        static constexpr field_ifma::Modulus modulus = field_ifma::get_modulus<T>();
+        if (num_vectorized > 0) {
+            field_ifma::mul_add(result.data()->data, lhs.data()->data, rhs.data()->data, num_vectorized, modulus);
+        }
+    }
+#endif
+    for (size_t i = num_vectorized; i < result.size(); ++i) {
+        result[i] += lhs[i] * rhs[i];
+    }
+}
+
+/**
+ * @brief Compute result[i] += scalar * other[i]
+ */
+template <class T>
+void field<T>::batch_add_scaled(std::span<field> result, std::span<const field> other, const field& scalar) noexcept
+{
+    ASSERT(other.size() == result.size());
+    const size_t num_vectorized = num_ifma_elements<T>(result.size());
+#if BB_FIELD_IFMA
+    if constexpr (field_ifma::is_compatible<T>) {
+        static constexpr field_ifma::Modulus modulus = field_ifma::get_modulus<T>();
+        if (num_vectorized > 0) {
+            field_ifma::add_scaled(result.data()->data, other.data()->data, scalar.data, num_vectorized, modulus);
+        }
+    }
+#endif
+    for (size_t i = num_vectorized; i < result.size(); ++i) {
+        result[i] += scalar * other[i];
+    }
+}
+
+/**
+ * @brief Compute result[i] = scalar * other[i]; result and other may be the same span
+ */
+template <class T>
+void field<T>::batch_scale(std::span<field> result, std::span<const field> other, const field& scalar) noexcept
+{
+    ASSERT(other.size() == result.size());
+    const size_t num_vectorized = num_ifma_elements<T>(result.size());
+#if BB_FIELD_IFMA
+    if constexpr (field_ifma::is_compatible<T>) {
+        static constexpr field_ifma::Modulus modulus = field_ifma::get_modulus<T>();
+        if (num_vectorized > 0) {
+            field_ifma::scale(result.data()->data, other.data()->data, scalar.data, num_vectorized, modulus);
+        }
+    }
+#endif
+    for (size_t i = num_vectorized; i < result.size(); ++i) {
+        result[i] = scalar * other[i];
+    }
+}
+
 template <class T> constexpr field<T> field<T>::tonelli_shanks_sqrt() const noexcept
 {
     BB_OP_COUNT_TRACK_NAME("fr::tonelli_shanks_sqrt");
@@ -0,0 +1,70 @@
+#include "barretenberg/ecc/curves/bn254/g1.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+/**
+ * @brief Distinct points P, P + Q, P + 2Q, ... in projective coordinates with non-trivial z
+ * @details Sampling every point with random_element would be a scalar multiplication per point, which is far too slow
+ * for the larger batches.
+ */
+template <typename Group> std::vector<typename Group::element> generate_points(const size_t num_points)
+{
+    using element = typename Group::element;
+    std::vector<element> points(num_points);
+    const element step = element::random_element();
+    element current = element::random_element();
+    for (auto& point : points) {
+        current += step;
+        point = current;
+    }
+    return points;
+}
+
+template <typename Group> std::vector<typename Group::affine_element> generate_affine_points(const size_t num_points)
+{
+    auto points = generate_points<Group>(num_points);
+    Group::element::batch_normalize(points);
+    return { points.begin(), points.end() };
+}
+
+template <typename Group> void batch_normalize_bench(State& state)
+{
+    const size_t num_points = 1UL << static_cast<size_t>(state.range(0));
+    const auto points = generate_points<Group>(num_points);
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto to_normalize = points;
+        state.ResumeTiming();
+        Group::element::batch_normalize(to_normalize);
+        DoNotOptimize(to_normalize.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_points));
+}
+
+template <typename Group> void batch_affine_add_bench(State& state)
+{
+    const size_t num_points = 1UL << static_cast<size_t>(state.range(0));
+    auto lhs = generate_affine_points<Group>(num_points);
+    auto rhs = generate_affine_points<Group>(num_points);
+    std::vector<typename Group::affine_element> results(num_points);
+    for (auto _ : state) {
+        Group::element::batch_affine_add(lhs, rhs, results);
+        DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_points));
+}
+
+} // namespace
+
+BENCHMARK(batch_normalize_bench<g1>)->DenseRange(16, 22, 2)->Unit(kMillisecond);
+BENCHMARK(batch_normalize_bench<grumpkin::g1>)->DenseRange(16, 22, 2)->Unit(kMillisecond);
+BENCHMARK(batch_affine_add_bench<g1>)->DenseRange(16, 22, 2)->Unit(kMillisecond);
+BENCHMARK(batch_affine_add_bench<grumpkin::g1>)->DenseRange(16, 22, 2)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
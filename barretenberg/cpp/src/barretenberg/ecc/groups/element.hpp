@@ -91,6 +91,7 @@ template <class Fq, class Fr, class Params> class alignas(32) element {
     BB_INLINE constexpr bool operator==(const element& other) const noexcept;
 
     static void batch_normalize(element* elements, size_t num_elements) noexcept;
+    static void batch_normalize(std::span<element> elements) noexcept;
     static void batch_affine_add(const std::span<affine_element<Fq, Fr, Params>>& first_group,
                                  const std::span<affine_element<Fq, Fr, Params>>& second_group,
                                  const std::span<affine_element<Fq, Fr, Params>>& results) noexcept;
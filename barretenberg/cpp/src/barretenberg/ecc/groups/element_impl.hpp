@@ -650,6 +650,70 @@ template <typename Element, std::size_t NUM_ROUNDS> struct EndomorphismWnaf {
     }
 };
 
+/**
+ * @brief Multiply every entry of a batch by the inverse of its denominator, with one field inversion shared by all
+ * threads
+ *
+ * @details Montgomery's batch inversion split across threads: each thread accumulates the prefix products of the
+ * denominators of its chunk, the products of the chunks are inverted together with a single inversion, and each
+ * thread then walks back through its chunk, recovering the inverse of every denominator from its prefix product.
+ *
+ * @param get_denominator i -> the non-zero denominator dᵢ. Called twice for every entry, the second time just before
+ * apply(i, ·), so it must be cheap and must not depend on the writes of apply to other entries
+ * @param apply (i, dᵢ⁻¹) -> consume the inverse of the i-th denominator
+ */
+template <typename Fq, typename GetDenominator, typename Apply>
+void parallel_batch_inversion(const size_t num_entries, const GetDenominator& get_denominator, const Apply& apply)
+{
+    // Small batches are not worth starting threads for
+    constexpr size_t MIN_ENTRIES_PER_THREAD = 1 << 8;
+    const size_t num_threads = calculate_num_threads(num_entries, MIN_ENTRIES_PER_THREAD);
+    const size_t chunk_size = (num_entries + num_threads - 1) / num_threads;
+    std::vector<Fq> prefix_products(num_entries);
+    std::vector<Fq> chunk_products(num_threads, Fq::one());
+
+    const auto for_each_chunk = [&](const auto& func) {
+        if (num_threads == 1) {
+            func(0);
+            return;
+        }
+        parallel_for(num_threads, func);
+    };
+    for_each_chunk([&](size_t chunk) {
+        const size_t start = std::min(chunk * chunk_size, num_entries);
+        const size_t end = std::min(start + chunk_size, num_entries);
+        Fq accumulator = Fq::one();
+        for (size_t i = start; i < end; ++i) {
+            prefix_products[i] = accumulator;
+            accumulator *= get_denominator(i);
+        }
+        chunk_products[chunk] = accumulator;
+    });
+
+    // Invert the products of the chunks with a single inversion
+    std::vector<Fq> chunk_inverses(num_threads);
+    Fq accumulator = Fq::one();
+    for (size_t chunk = 0; chunk < num_threads; ++chunk) {
+        chunk_inverses[chunk] = accumulator;
+        accumulator *= chunk_products[chunk];
+    }
+    accumulator = accumulator.invert();
+    for (size_t chunk = num_threads - 1; chunk < num_threads; --chunk) {
+        chunk_inverses[chunk] *= accumulator;
+        accumulator *= chunk_products[chunk];
+    }
+
+    for_each_chunk([&](size_t chunk) {
+        const size_t start = std::min(chunk * chunk_size, num_entries);
+        Fq accumulator = chunk_inverses[chunk];
+        for (size_t i = std::min(start + chunk_size, num_entries); i-- > start;) {
+            const Fq inverse = accumulator * prefix_products[i];
+            accumulator *= get_denominator(i);
+            apply(i, inverse);
+        }
+    });
+}
+
 } // namespace detail
 
 template <class Fq, class Fr, class T>
@@ -712,6 +776,10 @@ element<Fq, Fr, T> element<Fq, Fr, T>::mul_with_endomorphism(const Fr& scalar) c
 /**
  * @brief Pairwise affine add points in first and second group
  *
+ * @details The slopes of all the additions share one field inversion (see detail::parallel_batch_inversion). Points
+ * at infinity, equal points (doubling) and opposite points (whose sum is the point at infinity) are all handled.
+ * results may alias first_group or second_group.
+ *
  * @param first_group
  * @param second_group
  * @param results
@@ -724,58 +792,74 @@ void element<Fq, Fr, T>::batch_affine_add(const std::span<affine_element<Fq, Fr,
     typedef affine_element<Fq, Fr, T> affine_element;
     const size_t num_points = first_group.size();
     ASSERT(second_group.size() == first_group.size());
+    ASSERT(results.size() >= num_points);
 
-    // Space for temporary values
-    std::vector<Fq> scratch_space(num_points);
-
+    enum class Case : uint8_t { ADD, DOUBLE, FIRST, SECOND, OPPOSITE };
+    std::vector<Case> cases(num_points);
     parallel_for_heuristic(
-        num_points, [&](size_t i) { results[i] = first_group[i]; }, thread_heuristics::FF_COPY_COST * 2);
-
-    // TODO(#826): Same code as in batch mul
-    //  we can mutate rhs but NOT lhs!
-    //  output is stored in rhs
-    /**
-     * @brief Perform point addition rhs[i]=rhs[i]+lhs[i] with batch inversion
-     *
-     */
-    const auto batch_affine_add_chunked =
-        [](const affine_element* lhs, affine_element* rhs, const size_t point_count, Fq* personal_scratch_space) {
-            Fq batch_inversion_accumulator = Fq::one();
-
-            for (size_t i = 0; i < point_count; i += 1) {
-                personal_scratch_space[i] = lhs[i].x + rhs[i].x; // x2 + x1
-                rhs[i].x -= lhs[i].x;                            // x2 - x1
-                rhs[i].y -= lhs[i].y;                            // y2 - y1
-                rhs[i].y *= batch_inversion_accumulator;         // (y2 - y1)*accumulator_old
-                batch_inversion_accumulator *= (rhs[i].x);
+        num_points,
+        [&](size_t i) {
+            const affine_element& lhs = first_group[i];
+            const affine_element& rhs = second_group[i];
+            if (lhs.is_point_at_infinity()) {
+                cases[i] = Case::SECOND;
+            } else if (rhs.is_point_at_infinity()) {
+                cases[i] = Case::FIRST;
+            } else if (lhs.x != rhs.x) {
+                cases[i] = Case::ADD;
+            } else if (lhs.y == rhs.y && !lhs.y.is_zero()) {
+                cases[i] = Case::DOUBLE;
+            } else {
+                // P + (-P), including a point of order 2 added to itself
+                cases[i] = Case::OPPOSITE;
             }
-            batch_inversion_accumulator = batch_inversion_accumulator.invert();
-
-            for (size_t i = (point_count)-1; i < point_count; i -= 1) {
-                rhs[i].y *= batch_inversion_accumulator; // update accumulator
-                batch_inversion_accumulator *= rhs[i].x;
-                rhs[i].x = rhs[i].y.sqr();
-                rhs[i].x = rhs[i].x - (personal_scratch_space[i]); // x3 = lambda_squared - x2
-                                                                   // - x1
-                personal_scratch_space[i] = lhs[i].x - rhs[i].x;
-                personal_scratch_space[i] *= rhs[i].y;
-                rhs[i].y = personal_scratch_space[i] - lhs[i].y;
+        },
+        thread_heuristics::FF_ADDITION_COST * 2);
+
+    // λ = (y₂ - y₁) / (x₂ - x₁) for an addition and λ = (3x₁² + a) / 2y₁ for a doubling
+    const auto get_denominator = [&](size_t i) {
+        switch (cases[i]) {
+        case Case::ADD:
+            return second_group[i].x - first_group[i].x;
+        case Case::DOUBLE:
+            return first_group[i].y + first_group[i].y;
+        default:
+            return Fq::one();
+        }
+    };
+    const auto apply = [&](size_t i, const Fq& denominator_inverse) {
+        const affine_element lhs = first_group[i];
+        const affine_element rhs = second_group[i];
+        switch (cases[i]) {
+        case Case::ADD:
+        case Case::DOUBLE: {
+            Fq lambda;
+            if (cases[i] == Case::ADD) {
+                lambda = (rhs.y - lhs.y) * denominator_inverse;
+            } else {
+                Fq numerator = lhs.x.sqr();
+                numerator += numerator + numerator;
+                if constexpr (T::has_a) {
+                    numerator += T::a;
+                }
+                lambda = numerator * denominator_inverse;
             }
-        };
-
-    /**
-     * @brief Perform batch affine addition in parallel
-     *
-     */
-    const auto batch_affine_add_internal = [&](const affine_element* lhs, affine_element* rhs) {
-        parallel_for_heuristic(
-            num_points,
-            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
-                batch_affine_add_chunked(lhs + start, rhs + start, end - start, &scratch_space[0] + start);
-            },
-            thread_heuristics::FF_ADDITION_COST * 6 + thread_heuristics::FF_MULTIPLICATION_COST * 6);
+            const Fq x = lambda.sqr() - (lhs.x + rhs.x);
+            results[i] = affine_element(x, lambda * (lhs.x - x) - lhs.y);
+            break;
+        }
+        case Case::FIRST:
+            results[i] = lhs;
+            break;
+        case Case::SECOND:
+            results[i] = rhs;
+            break;
+        case Case::OPPOSITE:
+            results[i] = affine_element::infinity();
+            break;
+        }
     };
-    batch_affine_add_internal(&second_group[0], &results[0]);
+    detail::parallel_batch_inversion<Fq>(num_points, get_denominator, apply);
 }
 
 /**
@@ -1043,54 +1127,31 @@ void element<Fq, Fr, T>::conditional_negate_affine(const affine_element<Fq, Fr,
 template <typename Fq, typename Fr, typename T>
 void element<Fq, Fr, T>::batch_normalize(element* elements, const size_t num_elements) noexcept
 {
-    std::vector<Fq> temporaries;
-    temporaries.reserve(num_elements * 2);
-    Fq accumulator = Fq::one();
-
-    // Iterate over the points, computing the product of their z-coordinates.
-    // At each iteration, store the currently-accumulated z-coordinate in `temporaries`
-    for (size_t i = 0; i < num_elements; ++i) {
-        temporaries.emplace_back(accumulator);
-        if (!elements[i].is_point_at_infinity()) {
-            accumulator *= elements[i].z;
-        }
-    }
-    // For the rest of this method we refer to the product of all z-coordinates as the 'global' z-coordinate
-    // Invert the global z-coordinate and store in `accumulator`
-    accumulator = accumulator.invert();
+    batch_normalize(std::span{ elements, num_elements });
+}
 
-    /**
-     * We now proceed to iterate back down the array of points.
-     * At each iteration we update the accumulator to contain the z-coordinate of the currently worked-upon
-     *z-coordinate. We can then multiply this accumulator with `temporaries`, to get a scalar that is equal to the
-     *inverse of the z-coordinate of the point at the next iteration cycle e.g. Imagine we have 4 points, such that:
-     *
-     * accumulator = 1 / z.data[0]*z.data[1]*z.data[2]*z.data[3]
-     * temporaries[3] = z.data[0]*z.data[1]*z.data[2]
-     * temporaries[2] = z.data[0]*z.data[1]
-     * temporaries[1] = z.data[0]
-     * temporaries[0] = 1
-     *
-     * At the first iteration, accumulator * temporaries[3] = z.data[0]*z.data[1]*z.data[2] /
-     *z.data[0]*z.data[1]*z.data[2]*z.data[3]  = (1 / z.data[3]) We then update accumulator, such that:
-     *
-     * accumulator = accumulator * z.data[3] = 1 / z.data[0]*z.data[1]*z.data[2]
-     *
-     * At the second iteration, accumulator * temporaries[2] = z.data[0]*z.data[1] / z.data[0]*z.data[1]*z.data[2] =
-     *(1 z.data[2]) And so on, until we have computed every z-inverse!
-     *
-     * We can then convert out of Jacobian form (x = X / Z^2, y = Y / Z^3) with 4 muls and 1 square.
-     **/
-    for (size_t i = num_elements - 1; i < num_elements; --i) {
+/**
+ * @brief Convert the points to affine coordinates (z = 1) in place
+ *
+ * @details Inverts the z-coordinates of all the points with one field inversion shared across threads (see
+ * detail::parallel_batch_inversion), then converts out of Jacobian form (x = X / Z^2, y = Y / Z^3) with 3 muls and 1
+ * square per point. Points at infinity are left at infinity.
+ */
+template <typename Fq, typename Fr, typename T>
+void element<Fq, Fr, T>::batch_normalize(std::span<element> elements) noexcept
+{
+    const auto get_denominator = [&](size_t i) {
+        return elements[i].is_point_at_infinity() ? Fq::one() : elements[i].z;
+    };
+    const auto apply = [&](size_t i, const Fq& z_inv) {
         if (!elements[i].is_point_at_infinity()) {
-            Fq z_inv = accumulator * temporaries[i];
             Fq zz_inv = z_inv.sqr();
             elements[i].x *= zz_inv;
             elements[i].y *= (zz_inv * z_inv);
-            accumulator *= elements[i].z;
         }
         elements[i].z = Fq::one();
-    }
+    };
+    detail::parallel_batch_inversion<Fq>(elements.size(), get_denominator, apply);
 }
 
 template <typename Fq, typename Fr, typename T>
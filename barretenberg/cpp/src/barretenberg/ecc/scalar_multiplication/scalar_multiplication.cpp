@@ -995,6 +995,148 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(
     return pippenger(scalars, &G_mod[0], state, false);
 }
 
+/**
+ * @brief Return the bit width of the largest scalar, i.e. the smallest b such that every scalar is less than 2^b
+ * @details Scans the scalars in parallel, stopping early in each thread once a scalar wider than
+ * SMALL_SCALAR_MAX_BITS is found since no caller distinguishes between widths beyond that.
+ */
+template <typename Curve> size_t get_scalar_bit_width(std::span<const typename Curve::ScalarField> scalars)
+{
+    using Fr = typename Curve::ScalarField;
+
+    const size_t num_threads = calculate_num_threads(scalars.size());
+    const size_t block_size = (scalars.size() + num_threads - 1) / num_threads;
+    std::vector<size_t> thread_bit_widths(num_threads, 0);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * block_size;
+        const size_t end = std::min(start + block_size, scalars.size());
+        size_t num_bits = 0;
+        for (size_t i = start; i < end && num_bits <= SMALL_SCALAR_MAX_BITS; ++i) {
+            if (scalars[i].is_zero()) {
+                continue;
+            }
+            // Selectors are by far the most common small scalars; skip the conversion out of Montgomery form for them
+            if (scalars[i] == Fr::one()) {
+                num_bits = std::max<size_t>(num_bits, 1);
+                continue;
+            }
+            num_bits = std::max(num_bits, static_cast<size_t>(uint256_t(scalars[i]).get_msb()) + 1);
+        }
+        thread_bit_widths[thread_idx] = num_bits;
+    });
+    return *std::max_element(thread_bit_widths.begin(), thread_bit_widths.end());
+}
+
+/**
+ * @brief Multi-scalar multiplication for scalars of at most num_bits bits, whose cost scales with num_bits
+ * @details The points are split across threads. Each thread runs a bucket method over ⌈num_bits / c⌉ windows of c bits
+ * (rather than over the ~254 / c windows a full-width pippenger must process), adding every point into one bucket per
+ * window with a mixed addition. The windows are processed one after the other, so each thread only holds 2^c buckets.
+ * When num_bits == 1 (e.g. selectors) this degenerates into a plain sum of the points with a nonzero scalar, with no
+ * buckets at all. The function uses no runtime state, so it may run concurrently with
+ * other MSMs over the same points.
+ *
+ * @param scalars scalars, each less than 2^num_bits
+ * @param points the pippenger point table, i.e. the raw points are at the even indices
+ * @param num_bits upper bound on the bit width of the scalars, at most SMALL_SCALAR_MAX_BITS
+ */
+template <typename Curve>
+typename Curve::Element small_scalar_msm(std::span<const typename Curve::ScalarField> scalars,
+                                         const typename Curve::AffineElement* points,
+                                         const size_t num_bits)
+{
+    BB_OP_COUNT_TIME();
+    using Element = typename Curve::Element;
+    ASSERT(num_bits <= SMALL_SCALAR_MAX_BITS);
+    if (num_bits == 0) {
+        return Element::infinity();
+    }
+
+    const size_t num_threads = calculate_num_threads(scalars.size());
+    const size_t block_size = (scalars.size() + num_threads - 1) / num_threads;
+    std::vector<Element> thread_results(num_threads, Element::infinity());
+
+    if (num_bits == 1) {
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * block_size;
+            const size_t end = std::min(start + block_size, scalars.size());
+            Element& sum = thread_results[thread_idx];
+            for (size_t i = start; i < end; ++i) {
+                if (!scalars[i].is_zero()) {
+                    sum += points[i * 2];
+                }
+            }
+        });
+    } else {
+        // Each bucket costs two additions to reduce, so keep the number of buckets per window below the number of
+        // points each thread processes
+        const size_t window_bits = std::min(num_bits, get_optimal_bucket_width(block_size));
+        const size_t num_windows = (num_bits + window_bits - 1) / window_bits;
+        const size_t num_buckets = size_t(1) << window_bits;
+        const uint64_t window_mask = num_buckets - 1;
+
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * block_size;
+            const size_t end = std::min(start + block_size, scalars.size());
+
+            // Process one window at a time so a thread only ever holds a single window's buckets; rescanning the
+            // scalars per window is cheap next to the point additions
+            std::vector<Element> buckets(num_buckets);
+            Element& result = thread_results[thread_idx];
+            for (size_t window = num_windows; window-- > 0;) {
+                std::fill(buckets.begin(), buckets.end(), Element::infinity());
+                const size_t shift = window * window_bits;
+                for (size_t i = start; i < end; ++i) {
+                    if (scalars[i].is_zero()) {
+                        continue;
+                    }
+                    const uint64_t digit = (static_cast<uint64_t>(scalars[i]) >> shift) & window_mask;
+                    if (digit != 0) {
+                        buckets[digit] += points[i * 2];
+                    }
+                }
+
+                // Reduce the buckets with a running sum and accumulate into the result, from the top window down
+                for (size_t j = 0; j < window_bits; ++j) {
+                    result.self_dbl();
+                }
+                Element running_sum = Element::infinity();
+                for (size_t digit = num_buckets - 1; digit > 0; --digit) {
+                    running_sum += buckets[digit];
+                    result += running_sum;
+                }
+            }
+        });
+    }
+
+    Element result = Element::infinity();
+    for (const auto& thread_result : thread_results) {
+        result += thread_result;
+    }
+    return result;
+}
+
+/**
+ * @brief Commitment-oriented MSM that only pays for the bit width the scalars actually have
+ * @details Detects the bit width of the scalars and, if it is at most SMALL_SCALAR_MAX_BITS, runs small_scalar_msm
+ * (pure additions for 0/1 scalars); otherwise defers to pippenger_unsafe_optimized_for_non_dyadic_polys. The detection
+ * pass costs about one field multiplication per scalar, which is small against any pippenger.
+ */
+template <typename Curve>
+typename Curve::Element pippenger_unsafe_optimized_for_small_scalars(
+    std::span<const typename Curve::ScalarField> scalars,
+    std::span<typename Curve::AffineElement> points,
+    pippenger_runtime_state<Curve>& state)
+{
+    BB_OP_COUNT_TIME();
+    const size_t num_bits = get_scalar_bit_width<Curve>(scalars);
+    if (num_bits <= SMALL_SCALAR_MAX_BITS) {
+        ASSERT(scalars.size() <= points.size());
+        return small_scalar_msm<Curve>(scalars, points.data(), num_bits);
+    }
+    return pippenger_unsafe_optimized_for_non_dyadic_polys<Curve>(scalars, points, state);
+}
+
 // Explicit instantiation
 // BN254
 template void generate_pippenger_point_table<curve::BN254>(const curve::BN254::AffineElement* points,
@@ -1049,6 +1191,17 @@ template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve
     curve::BN254::AffineElement* points,
     pippenger_runtime_state<curve::BN254>& state);
 
+template size_t get_scalar_bit_width<curve::BN254>(std::span<const curve::BN254::ScalarField> scalars);
+
+template curve::BN254::Element small_scalar_msm<curve::BN254>(std::span<const curve::BN254::ScalarField> scalars,
+                                                              const curve::BN254::AffineElement* points,
+                                                              size_t num_bits);
+
+template curve::BN254::Element pippenger_unsafe_optimized_for_small_scalars<curve::BN254>(
+    std::span<const curve::BN254::ScalarField> scalars,
+    std::span<curve::BN254::AffineElement> points,
+    pippenger_runtime_state<curve::BN254>& state);
+
 // Grumpkin
 template void generate_pippenger_point_table<curve::Grumpkin>(const curve::Grumpkin::AffineElement* points,
                                                               curve::Grumpkin::AffineElement* table,
@@ -1103,6 +1256,18 @@ template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<cu
     curve::Grumpkin::AffineElement* points,
     pippenger_runtime_state<curve::Grumpkin>& state);
 
+template size_t get_scalar_bit_width<curve::Grumpkin>(std::span<const curve::Grumpkin::ScalarField> scalars);
+
+template curve::Grumpkin::Element small_scalar_msm<curve::Grumpkin>(
+    std::span<const curve::Grumpkin::ScalarField> scalars,
+    const curve::Grumpkin::AffineElement* points,
+    size_t num_bits);
+
+template curve::Grumpkin::Element pippenger_unsafe_optimized_for_small_scalars<curve::Grumpkin>(
+    std::span<const curve::Grumpkin::ScalarField> scalars,
+    std::span<curve::Grumpkin::AffineElement> points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
 } // namespace bb::scalar_multiplication
 
 // NOLINTEND(cppcoreguidelines-avoid-c-arrays, google-readability-casting)
@@ -176,6 +176,24 @@ typename Curve::Element pippenger_unsafe_optimized_for_non_dyadic_polys(
     std::span<typename Curve::AffineElement> points,
     pippenger_runtime_state<Curve>& state);
 
+// Scalars of at most this many bits are multiplied with `small_scalar_msm`; wider ones go through the wnaf pippenger
+constexpr size_t SMALL_SCALAR_MAX_BITS = 64;
+
+template <typename Curve> size_t get_scalar_bit_width(std::span<const typename Curve::ScalarField> scalars);
+
+template <typename Curve>
+typename Curve::Element small_scalar_msm(std::span<const typename Curve::ScalarField> scalars,
+                                         const typename Curve::AffineElement* points,
+                                         size_t num_bits);
+
+// NOTE: like pippenger_unsafe_optimized_for_non_dyadic_polys, requires SRS to have #scalars rounded up to nearest power
+// of 2 or above points.
+template <typename Curve>
+typename Curve::Element pippenger_unsafe_optimized_for_small_scalars(
+    std::span<const typename Curve::ScalarField> scalars,
+    std::span<typename Curve::AffineElement> points,
+    pippenger_runtime_state<Curve>& state);
+
 // Explicit instantiation
 // BN254
 
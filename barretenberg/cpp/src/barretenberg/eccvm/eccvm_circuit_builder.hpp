@@ -48,13 +48,14 @@ class ECCVMCircuitBuilder {
     std::vector<MSM> get_msms() const
     {
         const uint32_t num_muls = get_number_of_muls();
+        static constexpr size_t TABLE_SIZE = POINT_TABLE_SIZE + 1;
         /**
-         * For input point [P], return { -15[P], -13[P], ..., -[P], [P], ..., 13[P], 15[P] }
+         * For input point [P], write { -15[P], -13[P], ..., -[P], [P], ..., 13[P], 15[P], 2[P] } in projective form.
+         * The tables are normalised afterwards in batches spanning many scalar muls, which amortises the field
+         * inversion over all of them rather than paying one per table.
          */
-        const auto compute_precomputed_table =
-            [](const AffineElement& base_point) -> std::array<AffineElement, POINT_TABLE_SIZE + 1> {
+        const auto compute_precomputed_table = [](const AffineElement& base_point, Element* table) {
             const auto d2 = Element(base_point).dbl();
-            std::array<Element, POINT_TABLE_SIZE + 1> table;
             table[POINT_TABLE_SIZE] = d2; // need this for later
             table[POINT_TABLE_SIZE / 2] = base_point;
             for (size_t i = 1; i < POINT_TABLE_SIZE / 2; ++i) {
@@ -63,10 +64,10 @@ class ECCVMCircuitBuilder {
             for (size_t i = 0; i < POINT_TABLE_SIZE / 2; ++i) {
                 table[i] = -table[POINT_TABLE_SIZE - 1 - i];
             }
-
-            Element::batch_normalize(&table[0], POINT_TABLE_SIZE + 1);
-            std::array<AffineElement, POINT_TABLE_SIZE + 1> result;
-            for (size_t i = 0; i < POINT_TABLE_SIZE + 1; ++i) {
+        };
+        const auto get_affine_table = [](const Element* table) -> std::array<AffineElement, TABLE_SIZE> {
+            std::array<AffineElement, TABLE_SIZE> result;
+            for (size_t i = 0; i < TABLE_SIZE; ++i) {
                 result[i] = AffineElement(table[i].x, table[i].y);
             }
             return result;
@@ -145,6 +146,26 @@ class ECCVMCircuitBuilder {
         }
 
         parallel_for_range(msm_opqueue_index.size(), [&](size_t start, size_t end) {
+            const auto endo_point = [](const AffineElement& point) {
+                return AffineElement{ point.x * FF::cube_root_of_unity(), -point.y };
+            };
+            // Compute the point tables of every scalar mul in this chunk and normalise them together
+            std::vector<Element> tables;
+            tables.reserve(2 * (end - start) * TABLE_SIZE);
+            for (size_t i = start; i < end; i++) {
+                const auto& op = raw_ops[msm_opqueue_index[i]];
+                if (op.z1 != 0 && !op.base_point.is_point_at_infinity()) {
+                    tables.resize(tables.size() + TABLE_SIZE);
+                    compute_precomputed_table(op.base_point, &tables[tables.size() - TABLE_SIZE]);
+                }
+                if (op.z2 != 0 && !op.base_point.is_point_at_infinity()) {
+                    tables.resize(tables.size() + TABLE_SIZE);
+                    compute_precomputed_table(endo_point(op.base_point), &tables[tables.size() - TABLE_SIZE]);
+                }
+            }
+            Element::batch_normalize(tables.data(), tables.size());
+
+            size_t table_offset = 0;
             for (size_t i = start; i < end; i++) {
                 const auto& op = raw_ops[msm_opqueue_index[i]];
                 auto [msm_index, mul_index] = msm_mul_index[i];
@@ -157,22 +178,23 @@ class ECCVMCircuitBuilder {
                         .base_point = op.base_point,
                         .wnaf_digits = compute_wnaf_digits(op.z1),
                         .wnaf_skew = (op.z1 & 1) == 0,
-                        .precomputed_table = compute_precomputed_table(op.base_point),
+                        .precomputed_table = get_affine_table(&tables[table_offset]),
                     });
+                    table_offset += TABLE_SIZE;
                     mul_index++;
                 }
                 if (op.z2 != 0 && !op.base_point.is_point_at_infinity()) {
                     ASSERT(result.size() > msm_index);
                     ASSERT(result[msm_index].size() > mul_index);
-                    auto endo_point = AffineElement{ op.base_point.x * FF::cube_root_of_unity(), -op.base_point.y };
                     result[msm_index][mul_index] = (ScalarMul{
                         .pc = 0,
                         .scalar = op.z2,
-                        .base_point = endo_point,
+                        .base_point = endo_point(op.base_point),
                         .wnaf_digits = compute_wnaf_digits(op.z2),
                         .wnaf_skew = (op.z2 & 1) == 0,
-                        .precomputed_table = compute_precomputed_table(endo_point),
+                        .precomputed_table = get_affine_table(&tables[table_offset]),
                     });
+                    table_offset += TABLE_SIZE;
                 }
             }
         });
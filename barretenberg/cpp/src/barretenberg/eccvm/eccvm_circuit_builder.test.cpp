@@ -384,6 +384,29 @@ TEST(ECCVMCircuitBuilderTests, MSM)
     EXPECT_EQ(result, true);
 }
 
+/**
+ * @brief Chain many MSMs of very different sizes, so that the MSM trace is split between threads at MSM boundaries
+ * that do not line up with an even split of the MSMs
+ */
+TEST(ECCVMCircuitBuilderTests, ManyMSMsOfVaryingSize)
+{
+    static constexpr size_t num_msms = 48;
+    static constexpr size_t large_msm_size = 37;
+    auto generators = G1::derive_generators("test generators", large_msm_size);
+
+    std::shared_ptr<ECCOpQueue> op_queue = std::make_shared<ECCOpQueue>();
+    for (size_t j = 0; j < num_msms; ++j) {
+        const size_t msm_size = (j % 8 == 0) ? large_msm_size : (j % 5) + 1;
+        for (size_t i = 0; i < msm_size; ++i) {
+            op_queue->mul_accumulate(generators[i], Fr::random_element(&engine));
+        }
+        op_queue->eq_and_reset();
+    }
+    ECCVMCircuitBuilder circuit{ op_queue };
+    bool result = ECCVMTraceChecker::check(circuit, &engine);
+    EXPECT_EQ(result, true);
+}
+
 TEST(ECCVMCircuitBuilderTests, EqAgainstPointAtInfinity)
 {
     std::shared_ptr<ECCOpQueue> op_queue = std::make_shared<ECCOpQueue>();
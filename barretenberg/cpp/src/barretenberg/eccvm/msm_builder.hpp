@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
 
 #include "./eccvm_builder_types.hpp"
 #include "barretenberg/stdlib_circuit_builders/op_queue/ecc_op_queue.hpp"
@@ -45,6 +47,38 @@ class ECCVMMSMMBuilder {
         FF accumulator_y = 0;
     };
 
+    /**
+     * @brief Call `func(msm_idx)` for every MSM, distributing the MSMs between threads by trace rows rather than by
+     * count so that a few large MSMs do not end up on a single thread.
+     *
+     * @param msm_row_counts Prefix sum of the rows used by each MSM; MSM i occupies rows [msm_row_counts[i],
+     * msm_row_counts[i + 1]).
+     */
+    static void parallel_for_each_msm(const std::vector<size_t>& msm_row_counts,
+                                      const std::function<void(size_t)>& func)
+    {
+        const size_t num_msms = msm_row_counts.size() - 1;
+        if (num_msms == 0) {
+            return;
+        }
+        const size_t num_threads = std::min(get_num_cpus(), num_msms);
+        const size_t num_rows = msm_row_counts.back();
+        const auto msm_starts_begin = msm_row_counts.begin();
+        const auto msm_starts_end = msm_row_counts.end() - 1;
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            // each thread takes the MSMs that start within its share of the rows
+            const size_t row_start = (num_rows * thread_idx) / num_threads;
+            const size_t row_end = (num_rows * (thread_idx + 1)) / num_threads;
+            const auto first = std::lower_bound(msm_starts_begin, msm_starts_end, row_start);
+            const auto last = std::lower_bound(msm_starts_begin, msm_starts_end, row_end);
+            for (auto msm_idx = static_cast<size_t>(first - msm_starts_begin);
+                 msm_idx < static_cast<size_t>(last - msm_starts_begin);
+                 ++msm_idx) {
+                func(msm_idx);
+            }
+        });
+    }
+
     /**
      * @brief Computes the row values for the Straus MSM columns of the ECCVM.
      *
@@ -137,9 +171,8 @@ class ECCVMMSMMBuilder {
         msm_rows[0] = (MSMRow{});
         // compute "read counts" so that we can determine the number of times entries in our log-derivative lookup
         // tables are called.
-        // Note: this part is single-threaded. The amount of compute is low, however, so this is likely not a big
-        // concern.
-        for (size_t msm_idx = 0; msm_idx < msms.size(); ++msm_idx) {
+        // Every point belongs to exactly one MSM, so each MSM updates a disjoint set of read counts.
+        parallel_for_each_msm(msm_row_counts, [&](size_t msm_idx) {
             for (size_t digit_idx = 0; digit_idx < NUM_WNAF_DIGITS_PER_SCALAR; ++digit_idx) {
                 auto pc = static_cast<uint32_t>(pc_values[msm_idx]);
                 const auto& msm = msms[msm_idx];
@@ -182,7 +215,7 @@ class ECCVMMSMMBuilder {
                     }
                 }
             }
-        }
+        });
 
         // The execution trace data for the MSM columns requires knowledge of intermediate values from *affine* point
         // addition. The naive solution to compute this data requires 2 field inversions per in-circuit group addition
@@ -204,7 +237,8 @@ class ECCVMMSMMBuilder {
         std::span<Element> p2_trace(&points_to_normalize[num_point_adds_and_doubles], num_point_adds_and_doubles);
         std::span<Element> p3_trace(&points_to_normalize[num_point_adds_and_doubles * 2], num_point_adds_and_doubles);
         // operation_trace records whether an entry in the p1/p2/p3 trace represents a point addition or doubling
-        std::vector<bool> operation_trace(num_point_adds_and_doubles);
+        // (std::vector<bool> packs its entries into shared words, which cannot be written to concurrently)
+        std::vector<uint8_t> operation_trace(num_point_adds_and_doubles);
         // accumulator_trace tracks the value of the ECCVM accumulator for each row
         std::span<Element> accumulator_trace(&points_to_normalize[num_point_adds_and_doubles * 3], num_accumulators);
 
@@ -212,10 +246,10 @@ class ECCVMMSMMBuilder {
         constexpr auto offset_generator = bb::g1::derive_generators("ECCVM_OFFSET_GENERATOR", 1)[0];
         accumulator_trace[0] = offset_generator;
 
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/973): Reinstate multitreading?
         // populate point trace, and the components of the MSM execution trace that do not relate to affine point
-        // operations
-        for (size_t msm_idx = 0; msm_idx < msms.size(); msm_idx++) {
+        // operations. Every MSM starts from the offset generator and writes to its own rows (and trace entries), whose
+        // offsets are given by the prefix sums in msm_row_counts, so the MSMs are processed in parallel.
+        parallel_for_each_msm(msm_row_counts, [&](size_t msm_idx) {
             Element accumulator = offset_generator;
             const auto& msm = msms[msm_idx];
             size_t msm_row_index = msm_row_counts[msm_idx];
@@ -338,7 +372,7 @@ class ECCVMMSMMBuilder {
                     }
                 }
             }
-        }
+        });
 
         // Normalize the points in the point trace
         parallel_for_range(points_to_normalize.size(), [&](size_t start, size_t end) {
@@ -361,7 +395,7 @@ class ECCVMMSMMBuilder {
         // complete the computation of the ECCVM execution trace, by adding the affine intermediate point data
         // i.e. row.accumulator_x, row.accumulator_y, row.add_state[0...3].collision_inverse,
         // row.add_state[0...3].lambda
-        for (size_t msm_idx = 0; msm_idx < msms.size(); msm_idx++) {
+        parallel_for_each_msm(msm_row_counts, [&](size_t msm_idx) {
             const auto& msm = msms[msm_idx];
             size_t trace_index = ((msm_row_counts[msm_idx] - 1) * ADDITIONS_PER_ROW);
             size_t msm_row_index = msm_row_counts[msm_idx];
@@ -433,7 +467,7 @@ class ECCVMMSMMBuilder {
                     }
                 }
             }
-        }
+        });
 
         // populate the final row in the MSM execution trace.
         // we always require 1 extra row at the end of the trace, because the accumulator x/y coordinates for row `i`
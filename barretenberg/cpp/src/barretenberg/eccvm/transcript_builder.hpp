@@ -115,6 +115,19 @@ class ECCVMTranscriptBuilder {
             .is_accumulator_empty = true,
         };
         VMState updated_state;
+
+        // The scalar multiplications do not depend on the VM state, so we compute them in parallel up front. The
+        // sequential pass over the operations below then only has to perform group additions.
+        std::vector<Element> mul_outputs(num_vm_entries);
+        parallel_for_range(num_vm_entries, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                const bb::eccvm::VMOperation<CycleGroup>& entry = vm_operations[i];
+                if (entry.mul) {
+                    mul_outputs[i] = typename CycleGroup::element(entry.base_point) * entry.mul_scalar_full;
+                }
+            }
+        });
+
         // add an empty row. 1st row all zeroes because of our shiftable polynomials
         transcript_state[0] = (TranscriptRow{});
         for (size_t i = 0; i < vm_operations.size(); ++i) {
@@ -154,9 +167,8 @@ class ECCVMTranscriptBuilder {
             bool current_ongoing_msm = entry.mul && !next_not_msm;
             updated_state.count = current_ongoing_msm ? state.count + num_muls : 0;
             if (current_msm) {
-                const auto P = typename CycleGroup::element(entry.base_point);
                 const auto R = typename CycleGroup::element(state.msm_accumulator);
-                updated_state.msm_accumulator = R + P * entry.mul_scalar_full;
+                updated_state.msm_accumulator = R + mul_outputs[i];
             }
 
             if (msm_transition) {
@@ -215,106 +227,111 @@ class ECCVMTranscriptBuilder {
                 state.msm_accumulator = offset_generator();
             }
         }
-        Element::batch_normalize(&accumulator_trace[0], accumulator_trace.size());
-        Element::batch_normalize(&msm_accumulator_trace[0], msm_accumulator_trace.size());
-        Element::batch_normalize(&intermediate_accumulator_trace[0], intermediate_accumulator_trace.size());
+        // Every row is independent once the VM state has been computed, so the remaining work (normalisation, the
+        // values that need inverting and their batch inversion) is split into chunks of rows processed in parallel
+        parallel_for_range(num_vm_entries, [&](size_t start, size_t end) {
+            const size_t num_entries_in_chunk = end - start;
+            Element::batch_normalize(&accumulator_trace[start], num_entries_in_chunk);
+            Element::batch_normalize(&msm_accumulator_trace[start], num_entries_in_chunk);
+            Element::batch_normalize(&intermediate_accumulator_trace[start], num_entries_in_chunk);
 
-        for (size_t i = 0; i < accumulator_trace.size(); ++i) {
-            if (!accumulator_trace[i].is_point_at_infinity()) {
-                transcript_state[i + 1].accumulator_x = accumulator_trace[i].x;
-                transcript_state[i + 1].accumulator_y = accumulator_trace[i].y;
-            }
-            if (!msm_accumulator_trace[i].is_point_at_infinity()) {
-                transcript_state[i + 1].msm_output_x = msm_accumulator_trace[i].x;
-                transcript_state[i + 1].msm_output_y = msm_accumulator_trace[i].y;
-            }
-            if (!intermediate_accumulator_trace[i].is_point_at_infinity()) {
-                transcript_state[i + 1].transcript_msm_intermediate_x = intermediate_accumulator_trace[i].x;
-                transcript_state[i + 1].transcript_msm_intermediate_y = intermediate_accumulator_trace[i].y;
-            }
-        }
-        for (size_t i = 0; i < accumulator_trace.size(); ++i) {
-            auto& row = transcript_state[i + 1];
-            const bool msm_transition = row.msm_transition;
-            const bool add = row.q_add;
-            if (msm_transition) {
-                Element msm_output = intermediate_accumulator_trace[i];
-                row.transcript_msm_infinity = msm_output.is_point_at_infinity();
-                if (!row.transcript_msm_infinity) {
-                    transcript_msm_x_inverse_trace[i] = (msm_accumulator_trace[i].x - offset_generator().x);
-                } else {
-                    transcript_msm_x_inverse_trace[i] = 0;
+            for (size_t i = start; i < end; ++i) {
+                if (!accumulator_trace[i].is_point_at_infinity()) {
+                    transcript_state[i + 1].accumulator_x = accumulator_trace[i].x;
+                    transcript_state[i + 1].accumulator_y = accumulator_trace[i].y;
                 }
-                auto lhsx = msm_output.is_point_at_infinity() ? 0 : msm_output.x;
-                auto lhsy = msm_output.is_point_at_infinity() ? 0 : msm_output.y;
-                auto rhsx = accumulator_trace[i].is_point_at_infinity() ? 0 : accumulator_trace[i].x;
-                auto rhsy = accumulator_trace[i].is_point_at_infinity() ? (0) : accumulator_trace[i].y;
-                inverse_trace_x[i] = lhsx - rhsx;
-                inverse_trace_y[i] = lhsy - rhsy;
-            } else if (add) {
-                auto lhsx = row.base_x;
-                auto lhsy = row.base_y;
-                auto rhsx = accumulator_trace[i].is_point_at_infinity() ? 0 : accumulator_trace[i].x;
-                auto rhsy = accumulator_trace[i].is_point_at_infinity() ? (0) : accumulator_trace[i].y;
-                inverse_trace_x[i] = lhsx - rhsx;
-                inverse_trace_y[i] = lhsy - rhsy;
-            } else {
-                inverse_trace_x[i] = 0;
-                inverse_trace_y[i] = 0;
-            }
-            // msm transition = current row is doing a lookup to validate output = msm output
-            // i.e. next row is not part of MSM and current row is part of MSM
-            //   or next row is irrelevent and current row is a straight MUL
-            const bb::eccvm::VMOperation<CycleGroup>& entry = vm_operations[i];
-            if (entry.add || msm_transition) {
-                Element lhs = entry.add ? Element(entry.base_point) : intermediate_accumulator_trace[i];
-                Element rhs = accumulator_trace[i];
-                FF lhs_y = lhs.y;
-                FF lhs_x = lhs.x;
-                FF rhs_y = rhs.y;
-                FF rhs_x = rhs.x;
-                if (rhs.is_point_at_infinity()) {
-                    rhs_y = 0;
-                    rhs_x = 0;
+                if (!msm_accumulator_trace[i].is_point_at_infinity()) {
+                    transcript_state[i + 1].msm_output_x = msm_accumulator_trace[i].x;
+                    transcript_state[i + 1].msm_output_y = msm_accumulator_trace[i].y;
                 }
-                if (lhs.is_point_at_infinity()) {
-                    lhs_y = 0;
-                    lhs_x = 0;
+                if (!intermediate_accumulator_trace[i].is_point_at_infinity()) {
+                    transcript_state[i + 1].transcript_msm_intermediate_x = intermediate_accumulator_trace[i].x;
+                    transcript_state[i + 1].transcript_msm_intermediate_y = intermediate_accumulator_trace[i].y;
                 }
-                row.transcript_add_x_equal =
-                    lhs_x == rhs_x || (lhs.is_point_at_infinity() && rhs.is_point_at_infinity()); // check infinity?
-                row.transcript_add_y_equal =
-                    lhs_y == rhs_y || (lhs.is_point_at_infinity() && rhs.is_point_at_infinity());
-                if ((lhs_x == rhs_x) && (lhs_y == rhs_y) && !lhs.is_point_at_infinity() &&
-                    !rhs.is_point_at_infinity()) {
-                    add_lambda_denominator[i] = lhs_y + lhs_y;
-                    add_lambda_numerator[i] = lhs_x * lhs_x * 3;
-                } else if ((lhs_x != rhs_x) && !lhs.is_point_at_infinity() && !rhs.is_point_at_infinity()) {
-                    add_lambda_denominator[i] = rhs_x - lhs_x;
-                    add_lambda_numerator[i] = rhs_y - lhs_y;
+            }
+            for (size_t i = start; i < end; ++i) {
+                auto& row = transcript_state[i + 1];
+                const bool msm_transition = row.msm_transition;
+                const bool add = row.q_add;
+                if (msm_transition) {
+                    Element msm_output = intermediate_accumulator_trace[i];
+                    row.transcript_msm_infinity = msm_output.is_point_at_infinity();
+                    if (!row.transcript_msm_infinity) {
+                        transcript_msm_x_inverse_trace[i] = (msm_accumulator_trace[i].x - offset_generator().x);
+                    } else {
+                        transcript_msm_x_inverse_trace[i] = 0;
+                    }
+                    auto lhsx = msm_output.is_point_at_infinity() ? 0 : msm_output.x;
+                    auto lhsy = msm_output.is_point_at_infinity() ? 0 : msm_output.y;
+                    auto rhsx = accumulator_trace[i].is_point_at_infinity() ? 0 : accumulator_trace[i].x;
+                    auto rhsy = accumulator_trace[i].is_point_at_infinity() ? (0) : accumulator_trace[i].y;
+                    inverse_trace_x[i] = lhsx - rhsx;
+                    inverse_trace_y[i] = lhsy - rhsy;
+                } else if (add) {
+                    auto lhsx = row.base_x;
+                    auto lhsy = row.base_y;
+                    auto rhsx = accumulator_trace[i].is_point_at_infinity() ? 0 : accumulator_trace[i].x;
+                    auto rhsy = accumulator_trace[i].is_point_at_infinity() ? (0) : accumulator_trace[i].y;
+                    inverse_trace_x[i] = lhsx - rhsx;
+                    inverse_trace_y[i] = lhsy - rhsy;
                 } else {
+                    inverse_trace_x[i] = 0;
+                    inverse_trace_y[i] = 0;
+                }
+                // msm transition = current row is doing a lookup to validate output = msm output
+                // i.e. next row is not part of MSM and current row is part of MSM
+                //   or next row is irrelevent and current row is a straight MUL
+                const bb::eccvm::VMOperation<CycleGroup>& entry = vm_operations[i];
+                if (entry.add || msm_transition) {
+                    Element lhs = entry.add ? Element(entry.base_point) : intermediate_accumulator_trace[i];
+                    Element rhs = accumulator_trace[i];
+                    FF lhs_y = lhs.y;
+                    FF lhs_x = lhs.x;
+                    FF rhs_y = rhs.y;
+                    FF rhs_x = rhs.x;
+                    if (rhs.is_point_at_infinity()) {
+                        rhs_y = 0;
+                        rhs_x = 0;
+                    }
+                    if (lhs.is_point_at_infinity()) {
+                        lhs_y = 0;
+                        lhs_x = 0;
+                    }
+                    row.transcript_add_x_equal =
+                        lhs_x == rhs_x || (lhs.is_point_at_infinity() && rhs.is_point_at_infinity()); // check infinity?
+                    row.transcript_add_y_equal =
+                        lhs_y == rhs_y || (lhs.is_point_at_infinity() && rhs.is_point_at_infinity());
+                    if ((lhs_x == rhs_x) && (lhs_y == rhs_y) && !lhs.is_point_at_infinity() &&
+                        !rhs.is_point_at_infinity()) {
+                        add_lambda_denominator[i] = lhs_y + lhs_y;
+                        add_lambda_numerator[i] = lhs_x * lhs_x * 3;
+                    } else if ((lhs_x != rhs_x) && !lhs.is_point_at_infinity() && !rhs.is_point_at_infinity()) {
+                        add_lambda_denominator[i] = rhs_x - lhs_x;
+                        add_lambda_numerator[i] = rhs_y - lhs_y;
+                    } else {
+                        add_lambda_numerator[i] = 0;
+                        add_lambda_denominator[i] = 0;
+                    }
+                } else {
+                    row.transcript_add_x_equal = 0;
+                    row.transcript_add_y_equal = 0;
                     add_lambda_numerator[i] = 0;
                     add_lambda_denominator[i] = 0;
                 }
-            } else {
-                row.transcript_add_x_equal = 0;
-                row.transcript_add_y_equal = 0;
-                add_lambda_numerator[i] = 0;
-                add_lambda_denominator[i] = 0;
             }
-        }
-        FF::batch_invert(&inverse_trace_x[0], num_vm_entries);
-        FF::batch_invert(&inverse_trace_y[0], num_vm_entries);
-        FF::batch_invert(&transcript_msm_x_inverse_trace[0], num_vm_entries);
-        FF::batch_invert(&add_lambda_denominator[0], num_vm_entries);
-        FF::batch_invert(&msm_count_at_transition_inverse_trace[0], num_vm_entries);
-        for (size_t i = 0; i < num_vm_entries; ++i) {
-            transcript_state[i + 1].base_x_inverse = inverse_trace_x[i];
-            transcript_state[i + 1].base_y_inverse = inverse_trace_y[i];
-            transcript_state[i + 1].transcript_msm_x_inverse = transcript_msm_x_inverse_trace[i];
-            transcript_state[i + 1].transcript_add_lambda = add_lambda_numerator[i] * add_lambda_denominator[i];
-            transcript_state[i + 1].msm_count_at_transition_inverse = msm_count_at_transition_inverse_trace[i];
-        }
+            FF::batch_invert(&inverse_trace_x[start], num_entries_in_chunk);
+            FF::batch_invert(&inverse_trace_y[start], num_entries_in_chunk);
+            FF::batch_invert(&transcript_msm_x_inverse_trace[start], num_entries_in_chunk);
+            FF::batch_invert(&add_lambda_denominator[start], num_entries_in_chunk);
+            FF::batch_invert(&msm_count_at_transition_inverse_trace[start], num_entries_in_chunk);
+            for (size_t i = start; i < end; ++i) {
+                transcript_state[i + 1].base_x_inverse = inverse_trace_x[i];
+                transcript_state[i + 1].base_y_inverse = inverse_trace_y[i];
+                transcript_state[i + 1].transcript_msm_x_inverse = transcript_msm_x_inverse_trace[i];
+                transcript_state[i + 1].transcript_add_lambda = add_lambda_numerator[i] * add_lambda_denominator[i];
+                transcript_state[i + 1].msm_count_at_transition_inverse = msm_count_at_transition_inverse_trace[i];
+            }
+        });
         TranscriptRow& final_row = transcript_state.back();
         final_row.pc = updated_state.pc;
         final_row.accumulator_x =
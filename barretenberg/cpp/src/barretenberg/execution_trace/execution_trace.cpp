@@ -19,7 +19,7 @@ void ExecutionTrace_<Flavor>::populate(Builder& builder, typename Flavor::Provin
     }
     if constexpr (IsUltraPlonkOrHonk<Flavor>) {
         ZoneScopedN("add_memory_records_to_proving_key");
-        add_memory_records_to_proving_key(trace_data, builder, proving_key);
+        add_memory_records_to_proving_key(trace_data.ram_rom_offset, builder, proving_key);
     }
 
     if constexpr (IsGoblinFlavor<Flavor>) {
@@ -35,7 +35,56 @@ void ExecutionTrace_<Flavor>::populate(Builder& builder, typename Flavor::Provin
 }
 
 template <class Flavor>
-void ExecutionTrace_<Flavor>::add_memory_records_to_proving_key(TraceData& trace_data,
+void ExecutionTrace_<Flavor>::populate_wires(Builder& builder,
+                                             typename Flavor::ProvingKey& proving_key,
+                                             bool is_structured)
+    requires IsUltraFlavor<Flavor>
+{
+    ZoneScopedN("trace populate wires");
+    proving_key.polynomials.set_shifted(); // Ensure shifted wires are set correctly
+
+    // Complete the public inputs execution trace block from builder.public_inputs
+    populate_public_inputs_block(builder);
+
+    auto get_blocks = [&]() {
+        if constexpr (!HasKeccak<Flavor>) {
+            return builder.blocks.get();
+        } else {
+            return builder.blocks.get_for_ultra_keccak();
+        }
+    };
+
+    auto wires = proving_key.polynomials.get_wires();
+    uint32_t ram_rom_offset = 0;
+    uint32_t offset = Flavor::has_zero_row ? 1 : 0; // Offset at which to place each block in the trace polynomials
+    for (auto& block : get_blocks()) {
+        auto block_size = static_cast<uint32_t>(block.size());
+
+        for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+            for (uint32_t block_row_idx = 0; block_row_idx < block_size; ++block_row_idx) {
+                wires[wire_idx][block_row_idx + offset] = builder.get_variable(block.wires[wire_idx][block_row_idx]);
+            }
+        }
+
+        if (block.has_ram_rom) {
+            ram_rom_offset = offset;
+        }
+        if (block.is_pub_inputs) {
+            proving_key.pub_inputs_offset = offset;
+        }
+
+        offset += is_structured ? block.get_fixed_size() : block_size;
+    }
+
+    add_memory_records_to_proving_key(ram_rom_offset, builder, proving_key);
+
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        add_ecc_op_wires_to_proving_key(builder, proving_key);
+    }
+}
+
+template <class Flavor>
+void ExecutionTrace_<Flavor>::add_memory_records_to_proving_key(uint32_t ram_rom_offset,
                                                                 Builder& builder,
                                                                 typename Flavor::ProvingKey& proving_key)
     requires IsUltraPlonkOrHonk<Flavor>
@@ -44,10 +93,10 @@ void ExecutionTrace_<Flavor>::add_memory_records_to_proving_key(TraceData& trace
 
     // Update indices of RAM/ROM reads/writes based on where block containing these gates sits in the trace
     for (auto& index : builder.memory_read_records) {
-        proving_key.memory_read_records.emplace_back(index + trace_data.ram_rom_offset);
+        proving_key.memory_read_records.emplace_back(index + ram_rom_offset);
     }
     for (auto& index : builder.memory_write_records) {
-        proving_key.memory_write_records.emplace_back(index + trace_data.ram_rom_offset);
+        proving_key.memory_write_records.emplace_back(index + ram_rom_offset);
     }
 }
 
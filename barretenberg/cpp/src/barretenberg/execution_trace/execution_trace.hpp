@@ -74,6 +74,18 @@ template <class Flavor> class ExecutionTrace_ {
      */
     static void populate(Builder& builder, ProvingKey&, bool is_structured = false);
 
+    /**
+     * @brief Given a circuit, populate only the wire polynomials of a proving key whose selector and sigma/id
+     * polynomials are already present (e.g. loaded from a key cache)
+     * @details The block layout is identical to that of `populate`, but no selectors are written and no copy cycles or
+     * permutation mapping are computed.
+     *
+     * @param builder
+     * @param is_structured whether or not the trace is to be structured with a fixed block size
+     */
+    static void populate_wires(Builder& builder, ProvingKey&, bool is_structured = false)
+        requires IsUltraFlavor<Flavor>;
+
   private:
     /**
      * @brief Add the memory records indicating which rows correspond to RAM/ROM reads/writes
@@ -83,11 +95,11 @@ template <class Flavor> class ExecutionTrace_ {
      * within the block containing them. To obtain the row index in the trace at large, we simply increment these
      * indices by the offset at which that block is placed into the trace.
      *
-     * @param trace_data
+     * @param ram_rom_offset offset of the block containing the RAM/ROM gates in the trace
      * @param builder
      * @param proving_key
      */
-    static void add_memory_records_to_proving_key(TraceData& trace_data,
+    static void add_memory_records_to_proving_key(uint32_t ram_rom_offset,
                                                   Builder& builder,
                                                   typename Flavor::ProvingKey& proving_key)
         requires IsUltraPlonkOrHonk<Flavor>;
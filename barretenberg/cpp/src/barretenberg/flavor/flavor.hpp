@@ -313,6 +313,20 @@ template <typename Tuple, bool ZK = false> constexpr auto create_sumcheck_tuple_
     }(seq);
 }
 
+/**
+ * @brief Create a tuple of tuples of blocks of univariates, the column-major analogue of
+ * create_sumcheck_tuple_of_tuples_of_univariates
+ */
+template <typename Tuple, size_t BLOCK_SIZE> constexpr auto create_sumcheck_tuple_of_tuples_of_univariate_blocks()
+{
+    constexpr auto seq = std::make_index_sequence<std::tuple_size_v<Tuple>>();
+    return []<size_t... I>(std::index_sequence<I...>) {
+        return std::make_tuple(
+            typename std::tuple_element_t<I, Tuple>::template SumcheckTupleOfUnivariateBlocksOverSubrelations<
+                BLOCK_SIZE>{}...);
+    }(seq);
+}
+
 /**
  * @brief Construct tuple of arrays
  * @details Container for storing value of each identity in each relation. Each Relation contributes an array of
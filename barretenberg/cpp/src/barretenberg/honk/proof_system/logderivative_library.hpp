@@ -1,8 +1,33 @@
 #pragma once
+#include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <concepts>
+#include <span>
+#include <tuple>
 #include <typeinfo>
 
 namespace bb {
 
+/**
+ * @brief A relation that can compute its inverse polynomial without copying full rows of the execution trace
+ * @details Such a relation lists the entities its read and write terms and its operation_exists_at_row(row) depend on
+ * (get_row_entities).
+ */
+template <typename Relation, typename Polynomials, typename AllValues>
+concept HasLogDerivativeRowEntities = requires(const Polynomials& polynomials, AllValues& row) {
+    Relation::get_row_entities(polynomials);
+    Relation::get_row_entities(row);
+};
+
+/**
+ * @brief A relation that determines whether the inverse is computed at a row from its selector polynomials directly,
+ * for relations whose selectors are not among their row entities
+ */
+template <typename Relation, typename Polynomials>
+concept HasLogDerivativeSelectorCheck = requires(const Polynomials& polynomials, size_t row_idx) {
+    { Relation::operation_exists_at_row(polynomials, row_idx) } -> std::convertible_to<bool>;
+};
+
 /**
  * @brief Compute the inverse polynomial I(X) required for logderivative lookups
  * *
@@ -21,23 +46,23 @@ namespace bb {
  *
  * The specific algebraic relations that define read terms and write terms are defined in Flavor::LookupRelation
  *
+ * The rows are split into chunks processed in parallel; each chunk computes the products of the terms at its active
+ * rows and then batch inverts its own range of the inverse polynomial. If the relation satisfies
+ * HasLogDerivativeRowEntities, only the entities used by the relation are copied into the row, and if it also satisfies
+ * HasLogDerivativeSelectorCheck inactive rows are skipped before copying anything. Otherwise every row is copied with
+ * get_row.
  */
 template <typename Flavor, typename Relation, typename Polynomials>
 void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_parameters, const size_t circuit_size)
 {
     using FF = typename Flavor::FF;
+    using AllValues = typename Flavor::AllValues;
     using Accumulator = typename Relation::ValueAccumulator0;
     constexpr size_t READ_TERMS = Relation::READ_TERMS;
     constexpr size_t WRITE_TERMS = Relation::WRITE_TERMS;
 
     auto& inverse_polynomial = Relation::template get_inverse_polynomial(polynomials);
-    for (size_t i = 0; i < circuit_size; ++i) {
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
-        auto row = polynomials.get_row(i);
-        bool has_inverse = Relation::operation_exists_at_row(row);
-        if (!has_inverse) {
-            continue;
-        }
+    const auto compute_denominator = [&](const auto& row) {
         FF denominator = 1;
         bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
             auto denominator_term =
@@ -49,11 +74,51 @@ void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_para
                 Relation::template compute_write_term<Accumulator, write_index>(row, relation_parameters);
             denominator *= denominator_term;
         });
-        inverse_polynomial[i] = denominator;
+        return denominator;
     };
 
-    // todo might be inverting zero in field bleh bleh
-    FF::batch_invert(inverse_polynomial);
+    constexpr size_t ROW_COST = thread_heuristics::FF_MULTIPLICATION_COST * (READ_TERMS + WRITE_TERMS + 3);
+    parallel_for_heuristic(
+        circuit_size,
+        [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+            if constexpr (HasLogDerivativeRowEntities<Relation, Polynomials, AllValues>) {
+                const Polynomials& source = polynomials;
+                const auto source_entities = Relation::get_row_entities(source);
+                // Only the entities used by the relation are ever populated
+                AllValues row;
+                auto row_entities = Relation::get_row_entities(row);
+                for (size_t i = start; i < end; ++i) {
+                    if constexpr (HasLogDerivativeSelectorCheck<Relation, Polynomials>) {
+                        if (!Relation::operation_exists_at_row(source, i)) {
+                            continue;
+                        }
+                    }
+                    bb::constexpr_for<0, std::tuple_size_v<decltype(row_entities)>, 1>([&]<size_t entity_idx> {
+                        std::get<entity_idx>(row_entities) = std::get<entity_idx>(source_entities)[i];
+                    });
+                    if constexpr (!HasLogDerivativeSelectorCheck<Relation, Polynomials>) {
+                        if (!Relation::operation_exists_at_row(row)) {
+                            continue;
+                        }
+                    }
+                    inverse_polynomial[i] = compute_denominator(row);
+                }
+            } else {
+                for (size_t i = start; i < end; ++i) {
+                    // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
+                    auto row = polynomials.get_row(i);
+                    if (!Relation::operation_exists_at_row(row)) {
+                        continue;
+                    }
+                    inverse_polynomial[i] = compute_denominator(row);
+                }
+            }
+            // Rows without an operation hold zero, which batch_invert skips
+            if (end > start) {
+                FF::batch_invert(std::span<FF>{ &inverse_polynomial[start], end - start });
+            }
+        },
+        ROW_COST);
 }
 
 /**
@@ -0,0 +1,234 @@
+#pragma once
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace bb {
+
+/**
+ * @brief Keeps the prover polynomials of a Honk proving key within a memory budget by spilling cold polynomials to a
+ * temporary file
+ *
+ * @details The prover reads its polynomials in phases: Oink computes and commits to the witness polynomials, the first
+ * round of sumcheck reads every polynomial, the later rounds only read the partially evaluated table of sumcheck, and
+ * the PCS (ZeroMorph) reads every polynomial once more. When the polynomials do not fit within the budget, spill()
+ * moves them, coldest first, to a shared mapping of an unlinked temporary file, and the prover calls enter() at the
+ * start of every phase. Spilled polynomials that the phase reads are prefetched while they fit within the budget next
+ * to the polynomials kept in memory; the others are written back and dropped from memory, to be faulted back in from
+ * the file on access. Paging is therefore a matter of performance only: a spilled polynomial is an ordinary polynomial
+ * backed by file pages, and the proof does not depend on the budget.
+ *
+ * The budget bounds the prover polynomials; the partially evaluated table of sumcheck (half the size of the prover
+ * polynomials in its first round), the commitment key and the PCS scratch polynomials come on top of it.
+ */
+template <typename Flavor> class ProverMemoryBudget {
+    using FF = typename Flavor::FF;
+    using Polynomial = typename Flavor::Polynomial;
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+
+  public:
+    enum class Phase {
+        OINK,                         // reads and writes the witness polynomials and a few precomputed ones
+        SUMCHECK,                     // the first round reads every polynomial
+        SUMCHECK_PARTIALLY_EVALUATED, // the later rounds only read the table of sumcheck
+        PCS,                          // reads every polynomial
+    };
+
+    explicit ProverMemoryBudget(size_t budget_bytes,
+                                std::filesystem::path directory = std::filesystem::temp_directory_path())
+        : budget_bytes(budget_bytes)
+        , directory(std::move(directory))
+    {}
+    ProverMemoryBudget(const ProverMemoryBudget&) = delete;
+    ProverMemoryBudget& operator=(const ProverMemoryBudget&) = delete;
+    ~ProverMemoryBudget()
+    {
+#ifndef __wasm__
+        // The mappings keep the file referenced until the polynomials are destroyed
+        if (fd >= 0) {
+            close(fd);
+        }
+#endif
+    }
+
+    /**
+     * @brief Move the unshifted polynomials to the spill file until the ones left in memory fit within the budget
+     * @details The precomputed polynomials go first, as Oink reads few of them. The shifted polynomials are views of
+     * the spilled memory after this call.
+     */
+    void spill(ProverPolynomials& polynomials)
+    {
+        for (auto& polynomial : polynomials.get_unshifted()) {
+            resident_bytes += backing_bytes(polynomial);
+        }
+        const auto spill_while_over_budget = [&](auto polynomials_to_spill, bool precomputed) {
+            for (auto& polynomial : polynomials_to_spill) {
+                if (resident_bytes <= budget_bytes) {
+                    return;
+                }
+                resident_bytes -= backing_bytes(polynomial);
+                polynomial = spill_polynomial(polynomial, precomputed);
+            }
+        };
+        spill_while_over_budget(polynomials.get_precomputed(), /*precomputed=*/true);
+        spill_while_over_budget(polynomials.get_witness(), /*precomputed=*/false);
+        polynomials.set_shifted();
+#ifdef __GLIBC__
+        // glibc keeps freed memory in the heap for reuse; hand the memory of the spilled polynomials back to the OS
+        malloc_trim(0);
+#endif
+        if (!spilled.empty()) {
+            vinfo("memory budget: spilled ", spilled.size(), " polynomials (", spilled_bytes() >> 20, " MiB) to disk");
+        }
+    }
+
+    /**
+     * @brief Prefetch the spilled polynomials the phase reads while they fit within the budget, page out the others
+     */
+    void enter(Phase phase)
+    {
+        size_t headroom = budget_bytes > resident_bytes ? budget_bytes - resident_bytes : 0;
+        for (const auto& region : spilled) {
+            if (is_read_in(phase, region) && region.bytes <= headroom) {
+                headroom -= region.bytes;
+                page_in(region);
+            } else {
+                page_out(region);
+            }
+        }
+    }
+
+    size_t num_spilled() const { return spilled.size(); }
+
+    size_t spilled_bytes() const
+    {
+        size_t total = 0;
+        for (const auto& region : spilled) {
+            total += region.bytes;
+        }
+        return total;
+    }
+
+  private:
+    // The range of the spill file that backs a polynomial, mapped at data
+    struct Region {
+        FF* data;
+        size_t bytes;
+        size_t offset;
+        bool precomputed;
+    };
+
+    size_t budget_bytes;
+    std::filesystem::path directory;
+    // The bytes of the unshifted polynomials that have not been spilled
+    size_t resident_bytes = 0;
+    std::vector<Region> spilled;
+    size_t file_size = 0;
+    int fd = -1;
+
+    static bool is_read_in(Phase phase, const Region& region)
+    {
+        switch (phase) {
+        case Phase::OINK:
+            return !region.precomputed;
+        case Phase::SUMCHECK:
+        case Phase::PCS:
+            return true;
+        case Phase::SUMCHECK_PARTIALLY_EVALUATED:
+            return false;
+        }
+        return true;
+    }
+
+    // The memory of a polynomial includes the zeroes read by its shift
+    static size_t backing_bytes(const Polynomial& polynomial)
+    {
+        return polynomial.is_empty() ? 0 : (polynomial.size() + Polynomial::MAXIMUM_COEFFICIENT_SHIFT) * sizeof(FF);
+    }
+
+#ifndef __wasm__
+    Polynomial spill_polynomial(const Polynomial& polynomial, bool precomputed)
+    {
+        if (polynomial.is_empty()) {
+            return polynomial.share();
+        }
+        if (fd < 0) {
+            open_spill_file();
+        }
+        const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t bytes = (backing_bytes(polynomial) + page_size - 1) / page_size * page_size;
+        const size_t offset = file_size;
+        // Reserve the disk space up front, so that running out of it is an error here rather than a SIGBUS later
+#ifdef __linux__
+        const bool grown = posix_fallocate(fd, static_cast<off_t>(offset), static_cast<off_t>(bytes)) == 0;
+#else
+        const bool grown = ftruncate(fd, static_cast<off_t>(offset + bytes)) == 0;
+#endif
+        if (!grown) {
+            throw_or_abort("ProverMemoryBudget: failed to grow the spill file in " + directory.string());
+        }
+        file_size += bytes;
+
+        void* addr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, static_cast<off_t>(offset));
+        if (addr == MAP_FAILED) {
+            throw_or_abort("ProverMemoryBudget: failed to map the spill file");
+        }
+        auto* data = static_cast<FF*>(addr);
+        // The rest of the range, including the shift padding, reads as zeroes from the new file range
+        std::memcpy(static_cast<void*>(data), polynomial.data(), polynomial.size() * sizeof(FF));
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        std::shared_ptr<FF[]> memory(data, [bytes](FF* ptr) { munmap(ptr, bytes); });
+
+        spilled.push_back({ data, bytes, offset, precomputed });
+        page_out(spilled.back());
+        return Polynomial::from_backing_memory(std::move(memory), polynomial.size(), polynomial.virtual_size());
+    }
+
+    void open_spill_file()
+    {
+        std::string path = (directory / "bb-spill-XXXXXX").string();
+        fd = mkstemp(path.data());
+        if (fd < 0) {
+            throw_or_abort("ProverMemoryBudget: failed to create a spill file in " + directory.string());
+        }
+        // The space is released once the last mapping is gone, even if the prover aborts
+        unlink(path.c_str());
+    }
+
+    // Write the region back to the file and drop it from memory, including from the page cache
+    void page_out(const Region& region) const
+    {
+        msync(region.data, region.bytes, MS_SYNC);
+        madvise(region.data, region.bytes, MADV_DONTNEED);
+#ifdef __linux__
+        posix_fadvise(fd, static_cast<off_t>(region.offset), static_cast<off_t>(region.bytes), POSIX_FADV_DONTNEED);
+#endif
+    }
+
+    static void page_in(const Region& region) { madvise(region.data, region.bytes, MADV_WILLNEED); }
+#else
+    // WASM has no file-backed mappings, so a budget can only be met by keeping everything in memory
+    Polynomial spill_polynomial(const Polynomial& /*unused*/, bool /*unused*/)
+    {
+        throw_or_abort("ProverMemoryBudget: spilling polynomials to disk is not supported in WASM");
+    }
+    void page_out(const Region& /*unused*/) const {}
+    static void page_in(const Region& /*unused*/) {}
+#endif
+};
+
+} // namespace bb
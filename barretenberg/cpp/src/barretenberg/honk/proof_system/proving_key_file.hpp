@@ -0,0 +1,170 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/common/zip_view.hpp"
+#include "barretenberg/numeric/bitop/pow.hpp"
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief On-disk format for the precomputed polynomials of a Honk proving key, designed to be memory-mapped
+ *
+ * @details The file consists of a header followed by one block per precomputed polynomial:
+ *
+ *   | header | pad | polynomial 0 | pad | polynomial 1 | pad | ... |
+ *
+ * The header holds a magic number, the format version, the circuit size, the number of public inputs and, for every
+ * polynomial, the byte offset and size of its block. Each block starts at a multiple of BLOCK_ALIGNMENT and contains
+ * the polynomial's coefficients in Montgomery form followed by Polynomial::MAXIMUM_COEFFICIENT_SHIFT zeroes, i.e.
+ * exactly the layout of a polynomial's backing memory. Loading a key therefore amounts to a single `mmap` of the file;
+ * each polynomial directly aliases its block and pages are only faulted in when touched.
+ *
+ * The file is mapped privately (copy-on-write), so concurrent provers share the clean pages through the page cache
+ * while a stray write can never modify the file. The format uses the host byte order and is intended for caches local
+ * to a machine rather than for distribution.
+ */
+template <typename Flavor> class ProvingKeyFile {
+    using ProvingKey = typename Flavor::ProvingKey;
+    using CommitmentKey = typename Flavor::CommitmentKey;
+    using Polynomial = typename Flavor::Polynomial;
+    using FF = typename Flavor::FF;
+
+  public:
+    static constexpr uint64_t MAGIC = 0x4b50'4b4e'4f48'4242; // "BBHONKPK"
+    static constexpr uint64_t FORMAT_VERSION = 1;
+    // A multiple of the page size on all supported platforms (4 KiB on x86-64, up to 64 KiB on aarch64)
+    static constexpr size_t BLOCK_ALIGNMENT = 1 << 16;
+
+    /**
+     * @brief Write the precomputed polynomials of a proving key to a page-aligned file
+     */
+    static void write(const std::filesystem::path& path, ProvingKey& proving_key)
+    {
+        auto precomputed = proving_key.polynomials.get_precomputed();
+
+        Header header{ MAGIC, FORMAT_VERSION, proving_key.circuit_size, proving_key.num_public_inputs, {} };
+        uint64_t offset = align(sizeof(Header));
+        for (auto [block, polynomial] : zip_view(header.blocks, precomputed)) {
+            block.offset = offset;
+            block.size = polynomial.size();
+            offset = align(offset + (block.size + Polynomial::MAXIMUM_COEFFICIENT_SHIFT) * sizeof(FF));
+        }
+
+        std::ofstream os(path, std::ios::binary | std::ios::trunc);
+        if (!os) {
+            throw_or_abort("ProvingKeyFile: failed to open " + path.string() + " for writing");
+        }
+        os.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        const std::array<FF, Polynomial::MAXIMUM_COEFFICIENT_SHIFT> shift_padding{};
+        for (auto [block, polynomial] : zip_view(header.blocks, precomputed)) {
+            pad_to(os, block.offset);
+            os.write(reinterpret_cast<const char*>(polynomial.data()),
+                     static_cast<std::streamsize>(block.size * sizeof(FF)));
+            os.write(reinterpret_cast<const char*>(shift_padding.data()),
+                     static_cast<std::streamsize>(sizeof(shift_padding)));
+        }
+        // Extend the file to the end of the last block so that every block is fully backed by the mapping
+        pad_to(os, offset);
+        if (!os.good()) {
+            throw_or_abort("ProvingKeyFile: failed to write " + path.string());
+        }
+    }
+
+    /**
+     * @brief Map a proving key file into memory and construct a proving key whose precomputed polynomials alias it
+     * @details Only the witness polynomials are allocated. Returns nullopt if the file is missing or malformed.
+     * @note Unless a commitment key is passed in, the proving key constructs its own, so the CRS must have been
+     * initialised beforehand.
+     */
+    static std::optional<ProvingKey> read(const std::filesystem::path& path,
+                                          std::shared_ptr<CommitmentKey> commitment_key = nullptr)
+    {
+        ASSERT(BLOCK_ALIGNMENT % static_cast<size_t>(sysconf(_SC_PAGESIZE)) == 0);
+
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return std::nullopt;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Header)) {
+            close(fd);
+            return std::nullopt;
+        }
+        const auto file_size = static_cast<size_t>(st.st_size);
+        void* addr = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd); // the mapping keeps the file referenced
+        if (addr == MAP_FAILED) {
+            return std::nullopt;
+        }
+        std::shared_ptr<uint8_t> mapping(static_cast<uint8_t*>(addr),
+                                         [file_size](uint8_t* ptr) { munmap(ptr, file_size); });
+
+        Header header;
+        std::memcpy(&header, mapping.get(), sizeof(Header));
+        // The circuit size of a Honk proving key is a power of two, which also keeps the block bounds below from
+        // overflowing
+        if (header.magic != MAGIC || header.version != FORMAT_VERSION ||
+            !numeric::is_power_of_two(header.circuit_size) || header.num_public_inputs > header.circuit_size) {
+            return std::nullopt;
+        }
+        for (const auto& block : header.blocks) {
+            if (block.size > header.circuit_size || block.offset % BLOCK_ALIGNMENT != 0 || block.offset > file_size ||
+                block.size + Polynomial::MAXIMUM_COEFFICIENT_SHIFT > (file_size - block.offset) / sizeof(FF)) {
+                return std::nullopt;
+            }
+        }
+
+        // Initialise the proving key metadata without allocating any polynomial, then allocate only the witnesses
+        ProvingKey proving_key;
+        static_cast<typename ProvingKey::Base&>(proving_key) =
+            typename ProvingKey::Base(header.circuit_size, header.num_public_inputs, std::move(commitment_key));
+        for (auto& polynomial : proving_key.polynomials.get_witness()) {
+            polynomial = Polynomial(header.circuit_size);
+        }
+        for (auto [block, polynomial] : zip_view(header.blocks, proving_key.polynomials.get_precomputed())) {
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+            std::shared_ptr<FF[]> memory(mapping, reinterpret_cast<FF*>(mapping.get() + block.offset));
+            polynomial = Polynomial::from_backing_memory(std::move(memory), block.size, header.circuit_size);
+        }
+        proving_key.polynomials.set_shifted();
+        return proving_key;
+    }
+
+  private:
+    struct Block {
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    struct Header {
+        uint64_t magic;
+        uint64_t version;
+        uint64_t circuit_size;
+        uint64_t num_public_inputs;
+        std::array<Block, Flavor::NUM_PRECOMPUTED_ENTITIES> blocks;
+    };
+
+    static uint64_t align(uint64_t offset) { return (offset + BLOCK_ALIGNMENT - 1) & ~(BLOCK_ALIGNMENT - 1); }
+
+    static void pad_to(std::ostream& os, uint64_t offset)
+    {
+        static const std::vector<char> zeroes(BLOCK_ALIGNMENT, 0);
+        auto position = static_cast<uint64_t>(os.tellp());
+        ASSERT(position <= offset);
+        os.write(zeroes.data(), static_cast<std::streamsize>(offset - position));
+    }
+};
+
+} // namespace bb
@@ -74,6 +74,23 @@ template <typename FF, size_t NUM_WIRES, size_t NUM_SELECTORS> class ExecutionTr
 #endif
     }
 
+    /**
+     * @brief Grow the block to new_size rows, with zero wires and selectors, so that the new rows can be filled in
+     * concurrently
+     */
+    void resize(size_t new_size)
+    {
+        for (auto& w : wires) {
+            w.resize(new_size, 0);
+        }
+        for (auto& p : selectors) {
+            p.resize(new_size, FF(0));
+        }
+#ifdef CHECK_CIRCUIT_STACKTRACES
+        stack_traces.stack_traces.resize(new_size);
+#endif
+    }
+
     uint32_t get_fixed_size() const { return fixed_size; }
     void set_fixed_size(uint32_t size_in) { fixed_size = size_in; }
 };
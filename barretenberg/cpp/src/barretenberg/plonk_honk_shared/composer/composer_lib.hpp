@@ -29,9 +29,9 @@ void construct_lookup_table_polynomials(const RefArray<typename Flavor::Polynomi
         const fr table_index(table.table_index);
 
         for (size_t i = 0; i < table.size(); ++i) {
-            table_polynomials[0][offset] = table.column_1[i];
-            table_polynomials[1][offset] = table.column_2[i];
-            table_polynomials[2][offset] = table.column_3[i];
+            table_polynomials[0][offset] = table.column_1()[i];
+            table_polynomials[1][offset] = table.column_2()[i];
+            table_polynomials[2][offset] = table.column_3()[i];
             table_polynomials[3][offset] = table_index;
             ++offset;
         }
@@ -56,15 +56,16 @@ void construct_lookup_read_counts(typename Flavor::Polynomial& read_counts,
 
     size_t table_offset = offset; // offset of the present table in the table polynomials
     // loop over all tables used in the circuit; each table contains data about the lookups made on it
-    for (auto& table : circuit.lookup_tables) {
-        table.initialize_index_map();
+    for (const auto& table : circuit.lookup_tables) {
+        // the entry-index map is built once per process along with the shared table
+        const auto& index_map = table.index_map();
 
-        for (auto& gate_data : table.lookup_gates) {
+        for (const auto& gate_data : table.lookup_gates) {
             // convert lookup gate data to an array of three field elements, one for each of the 3 columns
-            auto table_entry = gate_data.to_table_components(table.use_twin_keys);
+            auto table_entry = gate_data.to_table_components(table.use_twin_keys());
 
             // find the index of the entry in the table
-            auto index_in_table = table.index_map[table_entry];
+            auto index_in_table = index_map[table_entry];
 
             // increment the read count at the corresponding index in the full polynomial
             size_t index_in_poly = table_offset + index_in_table;
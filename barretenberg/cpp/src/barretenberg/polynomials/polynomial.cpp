@@ -4,6 +4,7 @@
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "polynomial_arithmetic.hpp"
+#include "span_kernels.hpp"
 #include <cstddef>
 #include <fcntl.h>
 #include <list>
@@ -151,16 +152,12 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator+=(std::span<cons
     const size_t other_size = other.size();
     ASSERT(in_place_operation_viable(other_size));
 
-    size_t num_threads = calculate_num_threads(other_size);
-    size_t range_per_thread = other_size / num_threads;
-    size_t leftovers = other_size - (range_per_thread * num_threads);
-    parallel_for(num_threads, [&](size_t j) {
-        size_t offset = j * range_per_thread;
-        size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_.data()[i] += other[i];
-        }
-    });
+    parallel_for_heuristic(
+        other_size,
+        [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+            span_kernels::add<Fr>(as_span().subspan(start, end - start), other.subspan(start, end - start));
+        },
+        thread_heuristics::FF_ADDITION_COST);
 
     return *this;
 }
@@ -175,6 +172,11 @@ template <typename Fr> Fr Polynomial<Fr>::evaluate(const Fr& z) const
     return polynomial_arithmetic::evaluate(data(), z, size());
 }
 
+template <typename Fr> std::vector<Fr> Polynomial<Fr>::evaluate(std::span<const Fr> points) const
+{
+    return polynomial_arithmetic::evaluate(as_span(), points);
+}
+
 template <typename Fr> Fr Polynomial<Fr>::evaluate_mle(std::span<const Fr> evaluation_points, bool shift) const
 {
     const size_t m = evaluation_points.size();
@@ -278,16 +280,12 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator-=(std::span<cons
     const size_t other_size = other.size();
     ASSERT(in_place_operation_viable(other_size));
 
-    size_t num_threads = calculate_num_threads(other_size);
-    size_t range_per_thread = other_size / num_threads;
-    size_t leftovers = other_size - (range_per_thread * num_threads);
-    parallel_for(num_threads, [&](size_t j) {
-        size_t offset = j * range_per_thread;
-        size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_.data()[i] -= other[i];
-        }
-    });
+    parallel_for_heuristic(
+        other_size,
+        [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+            span_kernels::sub<Fr>(as_span().subspan(start, end - start), other.subspan(start, end - start));
+        },
+        thread_heuristics::FF_ADDITION_COST);
 
     return *this;
 }
@@ -296,16 +294,12 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator*=(const Fr scali
 {
     ASSERT(in_place_operation_viable());
 
-    size_t num_threads = calculate_num_threads(size());
-    size_t range_per_thread = size() / num_threads;
-    size_t leftovers = size() - (range_per_thread * num_threads);
-    parallel_for(num_threads, [&](size_t j) {
-        size_t offset = j * range_per_thread;
-        size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_.data()[i] *= scaling_factor;
-        }
-    });
+    parallel_for_heuristic(
+        size(),
+        [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+            span_kernels::scale<Fr>(as_span().subspan(start, end - start), scaling_factor);
+        },
+        thread_heuristics::FF_MULTIPLICATION_COST);
 
     return *this;
 }
@@ -315,16 +309,38 @@ template <typename Fr> void Polynomial<Fr>::add_scaled(std::span<const Fr> other
     const size_t other_size = other.size();
     ASSERT(in_place_operation_viable(other_size));
 
-    size_t num_threads = calculate_num_threads(other_size);
-    size_t range_per_thread = other_size / num_threads;
-    size_t leftovers = other_size - (range_per_thread * num_threads);
-    parallel_for(num_threads, [&](size_t j) {
-        size_t offset = j * range_per_thread;
-        size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            data()[i] += scaling_factor * other[i];
-        }
-    });
+    parallel_for_heuristic(
+        other_size,
+        [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+            span_kernels::axpy<Fr>(
+                as_span().subspan(start, end - start), other.subspan(start, end - start), scaling_factor);
+        },
+        thread_heuristics::FF_MULTIPLICATION_COST + thread_heuristics::FF_ADDITION_COST);
+}
+
+template <typename Fr>
+void Polynomial<Fr>::add_scaled(std::span<const std::span<const Fr>> others, std::span<const Fr> scaling_factors)
+{
+    ASSERT(others.size() == scaling_factors.size());
+    size_t max_other_size = 0;
+    for (const auto& other : others) {
+        max_other_size = std::max(max_other_size, other.size());
+    }
+    ASSERT(in_place_operation_viable(max_other_size));
+
+    parallel_for_heuristic(
+        max_other_size,
+        [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+            // Restrict every input to the chunk; inputs ending before the chunk contribute nothing to it
+            std::vector<std::span<const Fr>> chunks;
+            chunks.reserve(others.size());
+            for (const auto& other : others) {
+                const size_t chunk_start = std::min(start, other.size());
+                chunks.emplace_back(other.subspan(chunk_start, std::min(end, other.size()) - chunk_start));
+            }
+            span_kernels::multi_axpy<Fr>(as_span().subspan(start, end - start), chunks, scaling_factors);
+        },
+        others.size() * (thread_heuristics::FF_MULTIPLICATION_COST + thread_heuristics::FF_ADDITION_COST));
 }
 
 /**
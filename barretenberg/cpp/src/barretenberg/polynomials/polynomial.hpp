@@ -28,6 +28,10 @@ template <typename Fr> class Polynomial {
     using FF = Fr;
     enum class DontZeroMemory { FLAG };
 
+    // When a polynomial is instantiated from a size alone, the memory allocated corresponds to
+    // input size + MAXIMUM_COEFFICIENT_SHIFT to support 'shifted' coefficients efficiently.
+    const static size_t MAXIMUM_COEFFICIENT_SHIFT = 1;
+
     Polynomial(size_t size, size_t virtual_size);
     // Intended just for plonk, where size == virtual_size always
     Polynomial(size_t size)
@@ -68,6 +72,19 @@ template <typename Fr> class Polynomial {
      */
     Polynomial share() const;
 
+    /**
+     * @brief Wrap externally owned memory (e.g. a memory-mapped file) in a polynomial without copying
+     * @details The memory must hold size + MAXIMUM_COEFFICIENT_SHIFT elements, the trailing ones being zero, so that
+     * the polynomial can be shifted like one allocated by the usual constructors.
+     */
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    static Polynomial from_backing_memory(std::shared_ptr<Fr[]> backing_memory, size_t size, size_t virtual_size)
+    {
+        Polynomial p;
+        p.coefficients_ = SharedShiftedVirtualZeroesArray<Fr>{ size, virtual_size, 0, std::move(backing_memory) };
+        return p;
+    }
+
     void clear() { coefficients_ = SharedShiftedVirtualZeroesArray<Fr>{}; }
 
     /**
@@ -159,6 +176,10 @@ template <typename Fr> class Polynomial {
 
     Fr evaluate(const Fr& z, size_t target_size) const;
     Fr evaluate(const Fr& z) const;
+    /**
+     * @brief evaluates p(X) at each of the points, with one pass over the coefficients
+     */
+    std::vector<Fr> evaluate(std::span<const Fr> points) const;
 
     /**
      * @brief adds the polynomial q(X) 'other', multiplied by a scaling factor.
@@ -168,6 +189,15 @@ template <typename Fr> class Polynomial {
      */
     void add_scaled(std::span<const Fr> other, Fr scaling_factor);
 
+    /**
+     * @brief adds ∑ₖ sₖ⋅qₖ(X) for polynomials qₖ(X) 'others' and scaling factors sₖ, with one pass over this
+     * polynomial
+     *
+     * @param others q₀(X),…,qₖ₋₁(X), each of size at most the size of this polynomial
+     * @param scaling_factors s₀,…,sₖ₋₁
+     */
+    void add_scaled(std::span<const std::span<const Fr>> others, std::span<const Fr> scaling_factors);
+
     /**
      * @brief adds the polynomial q(X) 'other'.
      *
@@ -225,9 +255,6 @@ template <typename Fr> class Polynomial {
     bool in_place_operation_viable(size_t domain_size = 0) { return (size() >= domain_size); }
 
     void zero_memory_beyond(size_t start_position);
-    // When a polynomial is instantiated from a size alone, the memory allocated corresponds to
-    // input size + MAXIMUM_COEFFICIENT_SHIFT to support 'shifted' coefficients efficiently.
-    const static size_t MAXIMUM_COEFFICIENT_SHIFT = 1;
 
     // The underlying memory, with a bespoke (but minimal) shared array struct that fits our needs.
     // Namely, it supports polynomial shifts and 'virtual' zeroes past a size up until a 'virtual' size.
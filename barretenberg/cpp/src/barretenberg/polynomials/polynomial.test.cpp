@@ -57,3 +57,48 @@ TEST(Polynomial, Share)
 
     EXPECT_NE(poly_clone, poly);
 }
+
+// The span kernel backed arithmetic agrees with coefficient-wise scalar arithmetic
+TEST(Polynomial, ScaledSumsAndEvaluation)
+{
+    using FF = bb::fr;
+    using Polynomial = bb::Polynomial<FF>;
+    const size_t SIZE = 1000;
+    auto poly = Polynomial::random(SIZE);
+    auto q_0 = Polynomial::random(SIZE);
+    auto q_1 = Polynomial::random(SIZE / 2 + 3, SIZE); // shorter than poly
+    const FF s_0 = FF::random_element();
+    const FF s_1 = FF::random_element();
+
+    Polynomial expected(poly);
+    for (size_t i = 0; i < SIZE; ++i) {
+        expected[i] += s_0 * q_0[i] + s_1 * q_1.get(i);
+    }
+    Polynomial separately(poly);
+    separately.add_scaled(q_0, s_0);
+    separately.add_scaled(q_1, s_1);
+    EXPECT_EQ(separately, expected);
+
+    const std::vector<std::span<const FF>> others{ q_0.as_span(), q_1.as_span() };
+    const std::vector<FF> scaling_factors{ s_0, s_1 };
+    Polynomial fused(poly);
+    fused.add_scaled(others, scaling_factors);
+    EXPECT_EQ(fused, expected);
+
+    // Evaluate at more points than the width of a batch multiplication
+    std::vector<FF> points(11);
+    for (auto& point : points) {
+        point = FF::random_element();
+    }
+    const auto evaluations = poly.evaluate(points);
+    for (size_t k = 0; k < points.size(); ++k) {
+        FF expected_evaluation = 0;
+        FF power = 1;
+        for (size_t i = 0; i < SIZE; ++i) {
+            expected_evaluation += poly[i] * power;
+            power *= points[k];
+        }
+        EXPECT_EQ(evaluations[k], expected_evaluation);
+        EXPECT_EQ(poly.evaluate(points[k]), expected_evaluation);
+    }
+}
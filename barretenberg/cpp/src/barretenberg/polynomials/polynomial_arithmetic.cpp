@@ -5,6 +5,7 @@
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "iterate_over_domain.hpp"
+#include "span_kernels.hpp"
 #include <math.h>
 #include <memory.h>
 #include <memory>
@@ -763,28 +764,39 @@ void mul(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationD
 
 template <typename Fr> Fr evaluate(const Fr* coeffs, const Fr& z, const size_t n)
 {
-    size_t num_threads = get_num_cpus_pow2();
-    size_t range_per_thread = n / num_threads;
-    size_t leftovers = n - (range_per_thread * num_threads);
-    Fr* evaluations = new Fr[num_threads];
+    return evaluate(std::span{ coeffs, n }, std::span{ &z, 1 })[0];
+}
+
+/**
+ * @brief Evaluate a polynomial at several points with one pass over the coefficients
+ * @details Each thread evaluates its chunk of coefficients cᵢ, i ∈ [start, end), at every point with Horner's rule and
+ * scales the result by z^start; the evaluation is the sum of the contributions of the chunks.
+ */
+template <typename Fr> std::vector<Fr> evaluate(std::span<const Fr> coeffs, std::span<const Fr> points)
+{
+    // Each chunk costs an exponentiation per point on top of its Horner steps
+    constexpr size_t MIN_COEFFICIENTS_PER_THREAD = 1 << 10;
+    const size_t num_points = points.size();
+    const size_t num_threads = calculate_num_threads(coeffs.size(), MIN_COEFFICIENTS_PER_THREAD);
+    const size_t chunk_size = (coeffs.size() + num_threads - 1) / num_threads;
+    std::vector<Fr> chunk_evaluations(num_threads * num_points, Fr::zero());
     parallel_for(num_threads, [&](size_t j) {
-        Fr z_acc = z.pow(static_cast<uint64_t>(j * range_per_thread));
-        size_t offset = j * range_per_thread;
-        evaluations[j] = Fr::zero();
-        size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            Fr work_var = z_acc * coeffs[i];
-            evaluations[j] += work_var;
-            z_acc *= z;
+        const size_t start = std::min(j * chunk_size, coeffs.size());
+        const size_t end = std::min(start + chunk_size, coeffs.size());
+        const std::span<Fr> evaluations{ &chunk_evaluations[j * num_points], num_points };
+        span_kernels::evaluate(coeffs.subspan(start, end - start), points, evaluations);
+        for (size_t k = 0; k < num_points; ++k) {
+            evaluations[k] *= points[k].pow(static_cast<uint64_t>(start));
         }
     });
 
-    Fr r = Fr::zero();
+    std::vector<Fr> result(num_points, Fr::zero());
     for (size_t j = 0; j < num_threads; ++j) {
-        r += evaluations[j];
+        for (size_t k = 0; k < num_points; ++k) {
+            result[k] += chunk_evaluations[j * num_points + k];
+        }
     }
-    delete[] evaluations;
-    return r;
+    return result;
 }
 
 template <typename Fr> Fr evaluate(const std::vector<Fr*> coeffs, const Fr& z, const size_t large_n)
@@ -872,7 +884,7 @@ void compute_lagrange_polynomial_fft(Fr* l_1_coefficients,
     });
 
     // Compute 1/(X_i - 1) using Montgomery batch inversion
-    Fr::batch_invert(l_1_coefficients, target_domain.size);
+    Fr::parallel_batch_invert(std::span{ l_1_coefficients, target_domain.size });
 
     // Step 2: Compute numerator (1/n)*(X_i^n - 1)
     // First compute X_i^n (which forms a multiplicative subgroup of order k)
@@ -1429,6 +1441,7 @@ void compute_efficient_interpolation(const Fr* src, Fr* dest, const Fr* evaluati
 
 template fr evaluate<fr>(const fr*, const fr&, const size_t);
 template fr evaluate<fr>(const std::vector<fr*>, const fr&, const size_t);
+template std::vector<fr> evaluate<fr>(std::span<const fr>, std::span<const fr>);
 template void copy_polynomial<fr>(const fr*, fr*, size_t, size_t);
 template void fft_inner_serial<fr>(std::vector<fr*>, const size_t, const std::vector<fr*>&);
 template void fft_inner_parallel<fr>(std::vector<fr*>, const EvaluationDomain<fr>&, const fr&, const std::vector<fr*>&);
@@ -1474,6 +1487,8 @@ template void compute_efficient_interpolation<fr>(const fr*, fr*, const fr*, con
 
 template grumpkin::fr evaluate<grumpkin::fr>(const grumpkin::fr*, const grumpkin::fr&, const size_t);
 template grumpkin::fr evaluate<grumpkin::fr>(const std::vector<grumpkin::fr*>, const grumpkin::fr&, const size_t);
+template std::vector<grumpkin::fr> evaluate<grumpkin::fr>(std::span<const grumpkin::fr>,
+                                                           std::span<const grumpkin::fr>);
 template void copy_polynomial<grumpkin::fr>(const grumpkin::fr*, grumpkin::fr*, size_t, size_t);
 template void add<grumpkin::fr>(const grumpkin::fr*,
                                 const grumpkin::fr*,
@@ -24,6 +24,7 @@ template <typename Fr> Fr evaluate(std::span<const Fr> coeffs, const Fr& z)
     return evaluate(coeffs, z, coeffs.size());
 };
 template <typename Fr> Fr evaluate(const std::vector<Fr*> coeffs, const Fr& z, const size_t large_n);
+template <typename Fr> std::vector<Fr> evaluate(std::span<const Fr> coeffs, std::span<const Fr> points);
 template <typename Fr>
 void copy_polynomial(const Fr* src, Fr* dest, size_t num_src_coefficients, size_t num_target_coefficients);
 
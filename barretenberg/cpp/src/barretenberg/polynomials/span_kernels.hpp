@@ -0,0 +1,147 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
+/**
+ * @brief Single-threaded kernels for the element-wise arithmetic of polynomials over spans of field elements
+ *
+ * @details The multiplications go through the batch operations of the field (Fr::batch_mul, Fr::batch_add_scaled,
+ * Fr::batch_scale), which compute 8 elements at a time with AVX-512 IFMA where available, see field_ifma.hpp. Kernels
+ * that combine several inputs work in blocks of BLOCK_SIZE elements, so the output block stays in the L1 cache while
+ * each input is streamed through it. Callers are responsible for splitting the work across threads.
+ */
+namespace bb::span_kernels {
+
+// 2 KiB of field elements: small enough to keep a few blocks in the L1 cache, large enough to amortise the dispatch
+static constexpr size_t BLOCK_SIZE = 64;
+
+/**
+ * @brief y += x
+ */
+template <typename Fr> void add(std::span<Fr> y, std::span<const Fr> x)
+{
+    ASSERT(y.size() >= x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+        y[i] += x[i];
+    }
+}
+
+/**
+ * @brief y -= x
+ */
+template <typename Fr> void sub(std::span<Fr> y, std::span<const Fr> x)
+{
+    ASSERT(y.size() >= x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+        y[i] -= x[i];
+    }
+}
+
+/**
+ * @brief y *= a
+ */
+template <typename Fr> void scale(std::span<Fr> y, const Fr& a)
+{
+    Fr::batch_scale(y, y, a);
+}
+
+/**
+ * @brief y += a * x
+ */
+template <typename Fr> void axpy(std::span<Fr> y, std::span<const Fr> x, const Fr& a)
+{
+    ASSERT(y.size() >= x.size());
+    Fr::batch_add_scaled(y.subspan(0, x.size()), x, a);
+}
+
+/**
+ * @brief y += ∑ₖ aₖ⋅xₖ, with one pass over y
+ * @details The inputs may be shorter than y, in which case they are treated as padded with zeroes.
+ */
+template <typename Fr>
+void multi_axpy(std::span<Fr> y, std::span<const std::span<const Fr>> xs, std::span<const Fr> scalars)
+{
+    ASSERT(xs.size() == scalars.size());
+    for (size_t start = 0; start < y.size(); start += BLOCK_SIZE) {
+        const size_t end = std::min(start + BLOCK_SIZE, y.size());
+        for (size_t k = 0; k < xs.size(); ++k) {
+            if (start >= xs[k].size()) {
+                continue;
+            }
+            const size_t x_end = std::min(end, xs[k].size());
+            Fr::batch_add_scaled(y.subspan(start, x_end - start), xs[k].subspan(start, x_end - start), scalars[k]);
+        }
+    }
+}
+
+/**
+ * @brief ∑ᵢ a[i]⋅b[i]
+ */
+template <typename Fr> Fr inner_product(std::span<const Fr> a, std::span<const Fr> b)
+{
+    ASSERT(a.size() == b.size());
+    std::array<Fr, BLOCK_SIZE> products;
+    Fr result = Fr::zero();
+    for (size_t start = 0; start < a.size(); start += BLOCK_SIZE) {
+        const size_t length = std::min(BLOCK_SIZE, a.size() - start);
+        const std::span<Fr> block{ products.data(), length };
+        Fr::batch_mul(block, a.subspan(start, length), b.subspan(start, length));
+        for (const Fr& product : block) {
+            result += product;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Multilinear fold: result[j] = source[2j] + u⋅(source[2j+1] - source[2j]) for j < result.size()
+ * @details This is one round of partial evaluation of the multilinear extension of source in its lowest variable.
+ * result may not alias source.
+ */
+template <typename Fr> void fold(std::span<Fr> result, std::span<const Fr> source, const Fr& u)
+{
+    ASSERT(source.size() >= 2 * result.size());
+    std::array<Fr, BLOCK_SIZE> differences;
+    for (size_t start = 0; start < result.size(); start += BLOCK_SIZE) {
+        const size_t length = std::min(BLOCK_SIZE, result.size() - start);
+        for (size_t j = 0; j < length; ++j) {
+            const Fr& even = source[2 * (start + j)];
+            result[start + j] = even;
+            differences[j] = source[2 * (start + j) + 1] - even;
+        }
+        Fr::batch_add_scaled(result.subspan(start, length), std::span<const Fr>{ differences.data(), length }, u);
+    }
+}
+
+/**
+ * @brief Evaluate p(X) = ∑ᵢ coeffs[i]⋅Xⁱ at each of the points with Horner's rule
+ * @details The points are advanced in lockstep, one coefficient at a time. Their Horner chains are independent, so the
+ * multiplications of different points overlap rather than waiting on each other, and with enough points a step is a
+ * single batch multiplication.
+ */
+template <typename Fr> void evaluate(std::span<const Fr> coeffs, std::span<const Fr> points, std::span<Fr> evaluations)
+{
+    ASSERT(evaluations.size() == points.size());
+    // Below this many points a batch multiplication costs more to dispatch than it saves
+    constexpr size_t MIN_POINTS_FOR_BATCH_MUL = 8;
+    std::fill(evaluations.begin(), evaluations.end(), Fr::zero());
+    if (points.size() < MIN_POINTS_FOR_BATCH_MUL) {
+        for (size_t i = coeffs.size(); i-- > 0;) {
+            for (size_t k = 0; k < points.size(); ++k) {
+                evaluations[k] = evaluations[k] * points[k] + coeffs[i];
+            }
+        }
+        return;
+    }
+    for (size_t i = coeffs.size(); i-- > 0;) {
+        Fr::batch_mul(evaluations, evaluations, points);
+        for (Fr& evaluation : evaluations) {
+            evaluation += coeffs[i];
+        }
+    }
+}
+
+} // namespace bb::span_kernels
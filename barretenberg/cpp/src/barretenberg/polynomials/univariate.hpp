@@ -134,40 +134,42 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
 
     static Univariate random_element() { return get_random(); };
 
+    /**
+     * @brief Call op(i) for each index i that is not skipped, i.e. for 0 and skip_count + 1, ..., LENGTH - 1
+     *
+     * @details LENGTH and skip_count are compile-time constants, so the compiler fully unrolls this into a straight
+     * sequence of independent field operations. Forcing the unrolling with a fold over an index sequence measured no
+     * faster.
+     */
+    template <typename Op> static void for_each_active_index(Op&& op)
+    {
+        op(0);
+        for (size_t i = skip_count + 1; i < LENGTH; ++i) {
+            op(i);
+        }
+    }
+
     // Operations between Univariate and other Univariate
     bool operator==(const Univariate& other) const = default;
 
     Univariate& operator+=(const Univariate& other)
     {
-        evaluations[0] += other.evaluations[0];
-        for (size_t i = skip_count + 1; i < LENGTH; ++i) {
-            evaluations[i] += other.evaluations[i];
-        }
+        for_each_active_index([&](size_t i) { evaluations[i] += other.evaluations[i]; });
         return *this;
     }
     Univariate& operator-=(const Univariate& other)
     {
-        evaluations[0] -= other.evaluations[0];
-        for (size_t i = skip_count + 1; i < LENGTH; ++i) {
-
-            evaluations[i] -= other.evaluations[i];
-        }
+        for_each_active_index([&](size_t i) { evaluations[i] -= other.evaluations[i]; });
         return *this;
     }
     Univariate& operator*=(const Univariate& other)
     {
-        evaluations[0] *= other.evaluations[0];
-        for (size_t i = skip_count + 1; i < LENGTH; ++i) {
-            evaluations[i] *= other.evaluations[i];
-        }
+        for_each_active_index([&](size_t i) { evaluations[i] *= other.evaluations[i]; });
         return *this;
     }
     Univariate& self_sqr()
     {
-        evaluations[0].self_sqr();
-        for (size_t i = skip_count + 1; i < LENGTH; ++i) {
-            evaluations[i].self_sqr();
-        }
+        for_each_active_index([&](size_t i) { evaluations[i].self_sqr(); });
         return *this;
     }
     Univariate operator+(const Univariate& other) const
@@ -186,13 +188,7 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
     Univariate operator-() const
     {
         Univariate res(*this);
-        size_t i = 0;
-        for (auto& eval : res.evaluations) {
-            if (i == 0 || i >= (skip_count + 1)) {
-                eval = -eval;
-            }
-            i++;
-        }
+        for_each_active_index([&](size_t i) { res.evaluations[i] = -res.evaluations[i]; });
         return res;
     }
 
@@ -213,40 +209,18 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
     // Operations between Univariate and scalar
     Univariate& operator+=(const Fr& scalar)
     {
-        size_t i = 0;
-        for (auto& eval : evaluations) {
-            if (i == 0 || i >= (skip_count + 1)) {
-                eval += scalar;
-            }
-            i++;
-        }
+        for_each_active_index([&](size_t i) { evaluations[i] += scalar; });
         return *this;
     }
 
     Univariate& operator-=(const Fr& scalar)
     {
-        size_t i = 0;
-        for (auto& eval : evaluations) {
-            // If skip count is zero, will be enabled on every line, otherwise don't compute for [domain_start+1,..,
-            // domain_start + skip_count]
-            if (i == 0 || i >= (skip_count + 1)) {
-                eval -= scalar;
-            }
-            i++;
-        }
+        for_each_active_index([&](size_t i) { evaluations[i] -= scalar; });
         return *this;
     }
     Univariate& operator*=(const Fr& scalar)
     {
-        size_t i = 0;
-        for (auto& eval : evaluations) {
-            // If skip count is zero, will be enabled on every line, otherwise don't compute for [domain_start+1,..,
-            // domain_start + skip_count]
-            if (i == 0 || i >= (skip_count + 1)) {
-                eval *= scalar;
-            }
-            i++;
-        }
+        for_each_active_index([&](size_t i) { evaluations[i] *= scalar; });
         return *this;
     }
 
@@ -274,28 +248,19 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
     // Operations between Univariate and UnivariateView
     Univariate& operator+=(const UnivariateView<Fr, domain_end, domain_start, skip_count>& view)
     {
-        evaluations[0] += view.evaluations[0];
-        for (size_t i = skip_count + 1; i < LENGTH; ++i) {
-            evaluations[i] += view.evaluations[i];
-        }
+        for_each_active_index([&](size_t i) { evaluations[i] += view.evaluations[i]; });
         return *this;
     }
 
     Univariate& operator-=(const UnivariateView<Fr, domain_end, domain_start, skip_count>& view)
     {
-        evaluations[0] -= view.evaluations[0];
-        for (size_t i = skip_count + 1; i < LENGTH; ++i) {
-            evaluations[i] -= view.evaluations[i];
-        }
+        for_each_active_index([&](size_t i) { evaluations[i] -= view.evaluations[i]; });
         return *this;
     }
 
     Univariate& operator*=(const UnivariateView<Fr, domain_end, domain_start, skip_count>& view)
     {
-        evaluations[0] *= view.evaluations[0];
-        for (size_t i = skip_count + 1; i < LENGTH; ++i) {
-            evaluations[i] *= view.evaluations[i];
-        }
+        for_each_active_index([&](size_t i) { evaluations[i] *= view.evaluations[i]; });
         return *this;
     }
 
@@ -353,6 +318,9 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
      * and a subtraction: setting Δ = v1-v0, the values of f(X) are f(0)=v0, f(1)= v0 + Δ, v2 = f(1) + Δ, v3
      * = f(2) + Δ...
      *
+     * Over native fields, longer domains generalise this with the table of finite differences, so that extension
+     * never multiplies. The barycentric formula is kept for stdlib field types, whose circuits must not change.
+     *
      */
     template <size_t EXTENDED_DOMAIN_END, size_t NUM_SKIPPED_INDICES = 0>
     Univariate<Fr, EXTENDED_DOMAIN_END, 0, NUM_SKIPPED_INDICES> extend_to() const
@@ -451,6 +419,23 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
 
                 linear_term += three_a_plus_two_b;
             }
+        } else if constexpr (is_field_type_v<Fr>) {
+            // Native field: f has degree < LENGTH, so its (LENGTH-1)-th finite difference on consecutive points is
+            // constant. Write the backward differences ∇ᵐf at the last point of the domain into
+            // differences[LENGTH-1-m], with LENGTH(LENGTH-1)/2 subtractions; each new value then takes LENGTH-1
+            // additions and no multiplications, using ∇ᵐf(x+1) = ∇ᵐf(x) + ∇ᵐ⁺¹f(x+1).
+            std::array<Fr, LENGTH> differences = evaluations;
+            for (size_t m = 1; m < LENGTH; ++m) {
+                for (size_t i = 0; i + m < LENGTH; ++i) {
+                    differences[i] = differences[i + 1] - differences[i];
+                }
+            }
+            for (size_t idx = LENGTH; idx < EXTENDED_LENGTH; ++idx) {
+                for (size_t m = 1; m < LENGTH; ++m) {
+                    differences[m] += differences[m - 1];
+                }
+                result.evaluations[idx] = differences[LENGTH - 1];
+            }
         } else {
             for (size_t k = domain_end; k != EXTENDED_DOMAIN_END; ++k) {
                 result.value_at(k) = 0;
@@ -481,22 +466,40 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
             full_numerator_value *= u - i;
         }
 
-        // build set of domain size-many denominator inverses 1/(d_i*(x_k - x_j)). will multiply against
-        // each of these (rather than to divide by something) for each barycentric evaluation
-        std::array<Fr, LENGTH> denominator_inverses;
-        for (size_t i = 0; i != LENGTH; ++i) {
-            Fr inv = Data::lagrange_denominators[i];
-            inv *= u - Data::big_domain[i]; // warning: need to avoid zero here
-            inv = Fr(1) / inv;
-            denominator_inverses[i] = inv;
-        }
-
         Fr result = 0;
-        // compute each term v_j / (d_j*(x-x_j)) of the sum
-        for (size_t i = domain_start; i != domain_end; ++i) {
-            Fr term = value_at(i);
-            term *= denominator_inverses[i - domain_start];
-            result += term;
+        if constexpr (is_field_type_v<Fr>) {
+            // Native field: invert all of the denominators d_i*(u - x_i) with a single inversion (Montgomery's trick),
+            // accumulating the terms of the sum during the backward pass
+            std::array<Fr, LENGTH> denominators;
+            std::array<Fr, LENGTH> prefix_products;
+            Fr accumulator = 1;
+            for (size_t i = 0; i != LENGTH; ++i) {
+                denominators[i] = Data::lagrange_denominators[i] * (u - Data::big_domain[i]);
+                prefix_products[i] = accumulator;
+                accumulator *= denominators[i];
+            }
+            accumulator = accumulator.invert(); // warning: zero if u is in the domain
+            for (size_t i = LENGTH; i-- > 0;) {
+                result += evaluations[i] * accumulator * prefix_products[i];
+                accumulator *= denominators[i];
+            }
+        } else {
+            // build set of domain size-many denominator inverses 1/(d_i*(x_k - x_j)). will multiply against
+            // each of these (rather than to divide by something) for each barycentric evaluation
+            std::array<Fr, LENGTH> denominator_inverses;
+            for (size_t i = 0; i != LENGTH; ++i) {
+                Fr inv = Data::lagrange_denominators[i];
+                inv *= u - Data::big_domain[i]; // warning: need to avoid zero here
+                inv = Fr(1) / inv;
+                denominator_inverses[i] = inv;
+            }
+
+            // compute each term v_j / (d_j*(x-x_j)) of the sum
+            for (size_t i = domain_start; i != domain_end; ++i) {
+                Fr term = value_at(i);
+                term *= denominator_inverses[i - domain_start];
+                result += term;
+            }
         }
         // scale the sum by the value of of B(x)
         result *= full_numerator_value;
@@ -576,13 +579,8 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
     Univariate<Fr, domain_end, domain_start, skip_count> operator-() const
     {
         Univariate<Fr, domain_end, domain_start, skip_count> res(*this);
-        size_t i = 0;
-        for (auto& eval : res.evaluations) {
-            if (i == 0 || i >= (skip_count + 1)) {
-                eval = -eval;
-            }
-            i++;
-        }
+        Univariate<Fr, domain_end, domain_start, skip_count>::for_each_active_index(
+            [&](size_t i) { res.evaluations[i] = -res.evaluations[i]; });
         return res;
     }
 
@@ -150,3 +150,59 @@ TYPED_TEST(UnivariateTest, EvaluationCustomDomain)
         EXPECT_EQ(poly.evaluate(fr(2)), fr(294330751));
     }();
 }
+
+namespace {
+// Extend the values of a random polynomial of degree < LENGTH on {0, ..., LENGTH - 1} and evaluate it at a random point
+template <size_t LENGTH, size_t EXTENDED_LENGTH> void check_extension_and_evaluation()
+{
+    std::array<fr, LENGTH> coefficients;
+    for (auto& coefficient : coefficients) {
+        coefficient = fr::random_element();
+    }
+    auto evaluate = [&](const fr& x) {
+        fr result = 0;
+        for (size_t i = LENGTH; i-- > 0;) {
+            result = result * x + coefficients[i];
+        }
+        return result;
+    };
+
+    Univariate<fr, EXTENDED_LENGTH> expected;
+    for (size_t x = 0; x < EXTENDED_LENGTH; ++x) {
+        expected.value_at(x) = evaluate(fr(x));
+    }
+    Univariate<fr, LENGTH> f;
+    std::copy_n(expected.evaluations.begin(), LENGTH, f.evaluations.begin());
+    EXPECT_EQ(f.template extend_to<EXTENDED_LENGTH>(), expected);
+
+    const fr u = fr::random_element();
+    EXPECT_EQ(f.evaluate(u), evaluate(u));
+}
+} // namespace
+
+TYPED_TEST(UnivariateTest, ExtensionAndEvaluationOfRandomPolynomials)
+{
+    check_extension_and_evaluation<2, 7>();
+    check_extension_and_evaluation<3, 9>();
+    check_extension_and_evaluation<4, 12>();
+    check_extension_and_evaluation<5, 5>();
+    check_extension_and_evaluation<5, 12>();
+    check_extension_and_evaluation<6, 11>();
+    check_extension_and_evaluation<7, 19>();
+    check_extension_and_evaluation<9, 25>();
+}
+
+TYPED_TEST(UnivariateTest, SkippedIndices)
+{
+    // With skip_count = 2 the operators leave the values at indices 1 and 2 unchanged
+    Univariate<fr, 5, 0, 2> f{ { 1, 2, 3, 4, 5 } };
+    Univariate<fr, 5, 0, 2> g{ { 10, 20, 30, 40, 50 } };
+    EXPECT_EQ(f + g, (Univariate<fr, 5, 0, 2>{ { 11, 2, 3, 44, 55 } }));
+    EXPECT_EQ(g - f, (Univariate<fr, 5, 0, 2>{ { 9, 20, 30, 36, 45 } }));
+    EXPECT_EQ(f * g, (Univariate<fr, 5, 0, 2>{ { 10, 2, 3, 160, 250 } }));
+    EXPECT_EQ(f.sqr(), (Univariate<fr, 5, 0, 2>{ { 1, 2, 3, 16, 25 } }));
+    EXPECT_EQ(-f, (Univariate<fr, 5, 0, 2>{ { -1, 2, 3, -4, -5 } }));
+    EXPECT_EQ(f * fr(2) + fr(1), (Univariate<fr, 5, 0, 2>{ { 3, 2, 3, 9, 11 } }));
+    EXPECT_EQ((-UnivariateView<fr, 5, 0, 2>(f)), (Univariate<fr, 5, 0, 2>{ { -1, 2, 3, -4, -5 } }));
+    EXPECT_TRUE((Univariate<fr, 3, 0, 1>{ { 0, 7, 0 } }).is_zero());
+}
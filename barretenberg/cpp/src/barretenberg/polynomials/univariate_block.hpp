@@ -0,0 +1,223 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include <algorithm>
+#include <array>
+#include <span>
+
+namespace bb {
+
+template <class Fr, size_t LENGTH, size_t BLOCK_SIZE> class UnivariateBlock;
+
+/**
+ * @brief The edges (p(2e), p(2e + 1)), e = 0, ..., BLOCK_SIZE - 1, of a multilinear polynomial p in the current
+ * sumcheck round, seen as BLOCK_SIZE linear univariates that are extended lazily
+ *
+ * @details This is the entity type of the column-major sumcheck engine, see SumcheckProverRound. It points at the
+ * 2 * BLOCK_SIZE consecutive values of p rather than copying or extending them: a relation extends only the entities
+ * it reads, when it converts them to a UnivariateBlock (through its View type). Arithmetic directly on the edges, as
+ * in the generated AVM relations, produces blocks of length LENGTH, like arithmetic on the extended edges of the
+ * row-major engine.
+ */
+template <class Fr, size_t LENGTH, size_t BLOCK_SIZE> class EdgeBlock {
+  public:
+    using Block = UnivariateBlock<Fr, LENGTH, BLOCK_SIZE>;
+
+    // Points at 2 * BLOCK_SIZE values, the edge e being (values[2e], values[2e + 1])
+    const Fr* values = nullptr;
+
+    /**
+     * @brief Write the values of the edges on {0, ..., EXTENDED_LENGTH - 1} to result, point-major
+     * @details Linear univariates extend with one addition per point: f(k + 1) = f(k) + (f(1) - f(0)).
+     */
+    template <size_t EXTENDED_LENGTH> void extend_to(std::span<Fr, EXTENDED_LENGTH * BLOCK_SIZE> result) const
+    {
+        static_assert(EXTENDED_LENGTH >= 2);
+        std::array<Fr, BLOCK_SIZE> deltas;
+        for (size_t e = 0; e < BLOCK_SIZE; ++e) {
+            result[e] = values[2 * e];
+            result[BLOCK_SIZE + e] = values[2 * e + 1];
+            deltas[e] = values[2 * e + 1] - values[2 * e];
+        }
+        for (size_t k = 2; k < EXTENDED_LENGTH; ++k) {
+            for (size_t e = 0; e < BLOCK_SIZE; ++e) {
+                result[k * BLOCK_SIZE + e] = result[(k - 1) * BLOCK_SIZE + e] + deltas[e];
+            }
+        }
+    }
+
+    bool is_zero() const
+    {
+        return std::all_of(values, values + 2 * BLOCK_SIZE, [](const Fr& value) { return value.is_zero(); });
+    }
+
+    Block sqr() const { return Block(*this).sqr(); }
+    Block operator-() const { return -Block(*this); }
+
+    friend Block operator+(const EdgeBlock& lhs, const EdgeBlock& rhs) { return Block(lhs) + Block(rhs); }
+    friend Block operator-(const EdgeBlock& lhs, const EdgeBlock& rhs) { return Block(lhs) - Block(rhs); }
+    friend Block operator*(const EdgeBlock& lhs, const EdgeBlock& rhs) { return Block(lhs) * Block(rhs); }
+    friend Block operator+(const EdgeBlock& lhs, const Block& rhs) { return Block(lhs) + rhs; }
+    friend Block operator-(const EdgeBlock& lhs, const Block& rhs) { return Block(lhs) - rhs; }
+    friend Block operator*(const EdgeBlock& lhs, const Block& rhs) { return Block(lhs) * rhs; }
+    friend Block operator+(const Block& lhs, const EdgeBlock& rhs) { return lhs + Block(rhs); }
+    friend Block operator-(const Block& lhs, const EdgeBlock& rhs) { return lhs - Block(rhs); }
+    friend Block operator*(const Block& lhs, const EdgeBlock& rhs) { return lhs * Block(rhs); }
+    friend Block operator+(const EdgeBlock& lhs, const Fr& rhs) { return Block(lhs) + rhs; }
+    friend Block operator-(const EdgeBlock& lhs, const Fr& rhs) { return Block(lhs) - rhs; }
+    friend Block operator*(const EdgeBlock& lhs, const Fr& rhs) { return Block(lhs) * rhs; }
+    friend Block operator+(const Fr& lhs, const EdgeBlock& rhs) { return Block(rhs) + lhs; }
+    friend Block operator-(const Fr& lhs, const EdgeBlock& rhs) { return -Block(rhs) + lhs; }
+    friend Block operator*(const Fr& lhs, const EdgeBlock& rhs) { return Block(rhs) * lhs; }
+};
+
+/**
+ * @brief BLOCK_SIZE univariates represented by their values on {0, ..., LENGTH - 1}, stored point-major: the value of
+ * the e-th univariate at k is evaluations[k * BLOCK_SIZE + e]
+ *
+ * @details This is the accumulator type of the column-major sumcheck engine, the e-th univariate being the
+ * contribution of the e-th edge of a block of edges. The relations are generic over their accumulator type, so they
+ * evaluate each subrelation over a whole block with the code that evaluates it on a Univariate, but every arithmetic
+ * operation is now a loop over an array of LENGTH * BLOCK_SIZE field elements. Multiplications go through the batch
+ * operations of the field, which use AVX-512 IFMA where available. A block is its own View.
+ */
+template <class Fr, size_t LENGTH, size_t BLOCK_SIZE> class UnivariateBlock {
+  public:
+    static constexpr size_t SIZE = LENGTH * BLOCK_SIZE;
+    using View = UnivariateBlock;
+
+    std::array<Fr, SIZE> evaluations;
+
+    UnivariateBlock() = default;
+
+    // Construct the block of constant univariates with the given value
+    explicit UnivariateBlock(const Fr& value) { evaluations.fill(value); }
+
+    // Truncate a block of longer univariates
+    template <size_t OTHER_LENGTH>
+        requires(OTHER_LENGTH > LENGTH)
+    explicit UnivariateBlock(const UnivariateBlock<Fr, OTHER_LENGTH, BLOCK_SIZE>& other)
+    {
+        std::copy_n(other.evaluations.begin(), SIZE, evaluations.begin());
+    }
+
+    // Extend a block of edges
+    template <size_t EDGE_LENGTH> explicit UnivariateBlock(const EdgeBlock<Fr, EDGE_LENGTH, BLOCK_SIZE>& edges)
+    {
+        edges.template extend_to<LENGTH>(evaluations);
+    }
+
+    // The values of the univariates at k
+    std::span<const Fr, BLOCK_SIZE> values_at(size_t k) const
+    {
+        return std::span<const Fr, BLOCK_SIZE>(evaluations.data() + k * BLOCK_SIZE, BLOCK_SIZE);
+    }
+
+    bool is_zero() const
+    {
+        return std::all_of(evaluations.begin(), evaluations.end(), [](const Fr& value) { return value.is_zero(); });
+    }
+
+    UnivariateBlock& operator+=(const UnivariateBlock& other)
+    {
+        for (size_t i = 0; i < SIZE; ++i) {
+            evaluations[i] += other.evaluations[i];
+        }
+        return *this;
+    }
+    UnivariateBlock& operator-=(const UnivariateBlock& other)
+    {
+        for (size_t i = 0; i < SIZE; ++i) {
+            evaluations[i] -= other.evaluations[i];
+        }
+        return *this;
+    }
+    UnivariateBlock& operator*=(const UnivariateBlock& other)
+    {
+        Fr::batch_mul(evaluations, evaluations, other.evaluations);
+        return *this;
+    }
+    UnivariateBlock& self_sqr()
+    {
+        Fr::batch_mul(evaluations, evaluations, evaluations);
+        return *this;
+    }
+    UnivariateBlock& operator+=(const Fr& scalar)
+    {
+        for (auto& evaluation : evaluations) {
+            evaluation += scalar;
+        }
+        return *this;
+    }
+    UnivariateBlock& operator-=(const Fr& scalar)
+    {
+        for (auto& evaluation : evaluations) {
+            evaluation -= scalar;
+        }
+        return *this;
+    }
+    UnivariateBlock& operator*=(const Fr& scalar)
+    {
+        // The engine passes a scaling factor of one to the relations and applies the gate separators per edge
+        if (scalar != Fr::one()) {
+            Fr::batch_scale(evaluations, evaluations, scalar);
+        }
+        return *this;
+    }
+
+    UnivariateBlock operator+(const UnivariateBlock& other) const
+    {
+        UnivariateBlock res(*this);
+        res += other;
+        return res;
+    }
+    UnivariateBlock operator-(const UnivariateBlock& other) const
+    {
+        UnivariateBlock res(*this);
+        res -= other;
+        return res;
+    }
+    UnivariateBlock operator*(const UnivariateBlock& other) const
+    {
+        UnivariateBlock res;
+        Fr::batch_mul(res.evaluations, evaluations, other.evaluations);
+        return res;
+    }
+    UnivariateBlock sqr() const
+    {
+        UnivariateBlock res;
+        Fr::batch_mul(res.evaluations, evaluations, evaluations);
+        return res;
+    }
+    UnivariateBlock operator-() const
+    {
+        UnivariateBlock res;
+        for (size_t i = 0; i < SIZE; ++i) {
+            res.evaluations[i] = -evaluations[i];
+        }
+        return res;
+    }
+    UnivariateBlock operator+(const Fr& scalar) const
+    {
+        UnivariateBlock res(*this);
+        res += scalar;
+        return res;
+    }
+    UnivariateBlock operator-(const Fr& scalar) const
+    {
+        UnivariateBlock res(*this);
+        res -= scalar;
+        return res;
+    }
+    UnivariateBlock operator*(const Fr& scalar) const
+    {
+        UnivariateBlock res(*this);
+        res *= scalar;
+        return res;
+    }
+
+    friend UnivariateBlock operator+(const Fr& scalar, const UnivariateBlock& block) { return block + scalar; }
+    friend UnivariateBlock operator-(const Fr& scalar, const UnivariateBlock& block) { return -block + scalar; }
+    friend UnivariateBlock operator*(const Fr& scalar, const UnivariateBlock& block) { return block * scalar; }
+};
+
+} // namespace bb
@@ -257,7 +257,7 @@ template <typename FF_> class DatabusLookupRelationImpl {
             }
         }
         // Compute inverse polynomial I in place by inverting the product at each row
-        FF::batch_invert(inverse_polynomial);
+        FF::parallel_batch_invert(inverse_polynomial.as_span());
     };
 
     /**
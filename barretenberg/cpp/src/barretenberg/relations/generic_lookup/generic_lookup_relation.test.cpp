@@ -0,0 +1,135 @@
+#include "barretenberg/relations/generic_lookup/generic_lookup_relation.hpp"
+#include "barretenberg/honk/proof_system/logderivative_library.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include "barretenberg/relations/relation_parameters.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+using FF = fr;
+
+// A lookup of one value column into one table column, in the shape of the settings generated by bb-pilcom
+class TestLookupSettings {
+  public:
+    static constexpr size_t READ_TERMS = 1;
+    static constexpr size_t WRITE_TERMS = 1;
+    static constexpr size_t READ_TERM_TYPES[READ_TERMS] = { 0 };
+    static constexpr size_t WRITE_TERM_TYPES[WRITE_TERMS] = { 0 };
+    static constexpr size_t LOOKUP_TUPLE_SIZE = 1;
+    static constexpr size_t INVERSE_EXISTS_POLYNOMIAL_DEGREE = 4;
+    static constexpr size_t READ_TERM_DEGREE = 0;
+    static constexpr size_t WRITE_TERM_DEGREE = 0;
+
+    template <typename AllEntities> static inline auto inverse_polynomial_is_computed_at_row(const AllEntities& in)
+    {
+        return (in.sel_lookup == 1 || in.sel_table == 1);
+    }
+
+    template <typename Accumulator, typename AllEntities>
+    static inline auto compute_inverse_exists(const AllEntities& in)
+    {
+        using View = typename Accumulator::View;
+        const auto is_operation = View(in.sel_lookup);
+        const auto is_table_entry = View(in.sel_table);
+        return (is_operation + is_table_entry - is_operation * is_table_entry);
+    }
+
+    template <typename AllEntities> static inline auto get_const_entities(const AllEntities& in)
+    {
+        return std::forward_as_tuple(in.lookup_inv, in.lookup_counts, in.sel_lookup, in.sel_table, in.value, in.table);
+    }
+
+    template <typename AllEntities> static inline auto get_nonconst_entities(AllEntities& in)
+    {
+        return std::forward_as_tuple(in.lookup_inv, in.lookup_counts, in.sel_lookup, in.sel_table, in.value, in.table);
+    }
+};
+
+using TestLookupRelation = GenericLookupRelation<TestLookupSettings, FF>;
+
+template <typename DataType> struct TestEntities {
+    DataType lookup_inv;
+    DataType lookup_counts;
+    DataType sel_lookup;
+    DataType sel_table;
+    DataType value;
+    DataType table;
+};
+
+struct TestFlavor {
+    using FF = bb::fr;
+    using AllValues = TestEntities<FF>;
+};
+
+struct TestPolynomials : public TestEntities<Polynomial<FF>> {
+    TestFlavor::AllValues get_row(const size_t row_idx) const
+    {
+        return { lookup_inv[row_idx], lookup_counts[row_idx], sel_lookup[row_idx],
+                 sel_table[row_idx],  value[row_idx],         table[row_idx] };
+    }
+};
+
+} // namespace
+
+/**
+ * @brief Check that computing the inverse polynomial of a generic lookup in chunks, from the entities of the relation
+ * only, matches computing it row by row from full rows
+ * @details The rows are split into chunks when more than one cpu is available, e.g. with HARDWARE_CONCURRENCY=4
+ */
+TEST(GenericLookupRelation, LogDerivativeInverseMatchesRowByRow)
+{
+    constexpr size_t circuit_size = 1 << 14;
+    constexpr size_t table_size = circuit_size / 2;
+
+    TestPolynomials polynomials;
+    for (auto* polynomial : { &polynomials.lookup_inv,
+                              &polynomials.lookup_counts,
+                              &polynomials.sel_lookup,
+                              &polynomials.sel_table,
+                              &polynomials.value,
+                              &polynomials.table }) {
+        *polynomial = Polynomial<FF>(circuit_size);
+    }
+    // The table occupies the first half of the rows and is looked up from every third row; the remaining rows have
+    // neither selector enabled
+    for (size_t i = 0; i < circuit_size; ++i) {
+        if (i < table_size) {
+            polynomials.sel_table[i] = 1;
+            polynomials.table[i] = i;
+        }
+        if (i % 3 == 0) {
+            const size_t looked_up = engine.get_random_uint32() % table_size;
+            polynomials.sel_lookup[i] = 1;
+            polynomials.value[i] = looked_up;
+            polynomials.lookup_counts[looked_up] += 1;
+        }
+    }
+
+    const auto params = RelationParameters<FF>::get_random();
+    compute_logderivative_inverse<TestFlavor, TestLookupRelation>(polynomials, params, circuit_size);
+
+    using Accumulator = TestLookupRelation::ValueAccumulator0;
+    for (size_t i = 0; i < circuit_size; ++i) {
+        const auto row = polynomials.get_row(i);
+        FF expected = 0;
+        if (TestLookupRelation::operation_exists_at_row(row)) {
+            expected = (TestLookupRelation::compute_read_term<Accumulator, 0>(row, params) *
+                        TestLookupRelation::compute_write_term<Accumulator, 0>(row, params))
+                           .invert();
+        }
+        EXPECT_EQ(polynomials.lookup_inv[i], expected) << "row " << i;
+    }
+
+    // The inverse polynomial satisfies the relation
+    TestLookupRelation::SumcheckArrayOfValuesOverSubrelations result{ 0, 0 };
+    for (size_t i = 0; i < circuit_size; ++i) {
+        TestLookupRelation::accumulate(result, polynomials.get_row(i), params, 1);
+    }
+    EXPECT_EQ(result[0], 0);
+    EXPECT_EQ(result[1], 0);
+}
@@ -67,6 +67,20 @@ template <typename Settings, typename FF_> class GenericPermutationRelationImpl
         return Settings::inverse_polynomial_is_computed_at_row(row);
     }
 
+    /**
+     * @brief Get the entities used to compute the inverse polynomial at a row (see compute_logderivative_inverse)
+     * @details These include the selectors read by Settings::inverse_polynomial_is_computed_at_row, so
+     * operation_exists_at_row can be evaluated on a row in which only these entities are populated
+     */
+    template <typename AllEntities> static auto get_row_entities(AllEntities& in)
+    {
+        if constexpr (std::is_const_v<AllEntities>) {
+            return Settings::get_const_entities(in);
+        } else {
+            return Settings::get_nonconst_entities(in);
+        }
+    }
+
     /**
      * @brief Get the inverse permutation polynomial (needed to compute its value)
      *
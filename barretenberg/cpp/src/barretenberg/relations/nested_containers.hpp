@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/polynomials/univariate.hpp"
+#include "barretenberg/polynomials/univariate_block.hpp"
 #include <tuple>
 
 namespace bb {
@@ -47,6 +48,19 @@ template <typename FF, auto LENGTHS, size_t SKIP_COUNT>
 using TupleOfUnivariatesWithOptimisticSkipping =
     typename TupleOfContainersOverArray<bb::Univariate, FF, LENGTHS, 0, SKIP_COUNT>::type;
 
+// Types needed for the column-major sumcheck engine
+template <typename FF,
+          auto LENGTHS,
+          size_t BLOCK_SIZE,
+          typename IS = decltype(std::make_index_sequence<LENGTHS.size()>())>
+struct TupleOfUnivariateBlocksOverArray;
+template <typename FF, auto LENGTHS, size_t BLOCK_SIZE, std::size_t... I>
+struct TupleOfUnivariateBlocksOverArray<FF, LENGTHS, BLOCK_SIZE, std::index_sequence<I...>> {
+    using type = std::tuple<UnivariateBlock<FF, LENGTHS[I], BLOCK_SIZE>...>;
+};
+template <typename FF, auto LENGTHS, size_t BLOCK_SIZE>
+using TupleOfUnivariateBlocks = typename TupleOfUnivariateBlocksOverArray<FF, LENGTHS, BLOCK_SIZE>::type;
+
 template <typename FF, auto LENGTHS>
 using TupleOfValues = typename TupleOfContainersOverArray<ExtractValueType, FF, LENGTHS>::type;
 
@@ -192,6 +192,11 @@ template <typename RelationImpl> class Relation : public RelationImpl {
     using ZKSumcheckTupleOfUnivariatesOverSubrelations =
         TupleOfUnivariates<FF, compute_zk_partial_subrelation_lengths<RelationImpl>()>;
 
+    // The container for blocks of per-edge univariates in the column-major sumcheck engine
+    template <size_t BLOCK_SIZE>
+    using SumcheckTupleOfUnivariateBlocksOverSubrelations =
+        TupleOfUnivariateBlocks<FF, RelationImpl::SUBRELATION_PARTIAL_LENGTHS, BLOCK_SIZE>;
+
     using SumcheckArrayOfValuesOverSubrelations = ArrayOfValues<FF, RelationImpl::SUBRELATION_PARTIAL_LENGTHS>;
 
     // These are commonly needed, most importantly, for explicitly instantiating
@@ -969,6 +969,58 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeShortInputs)
     EXPECT_EQ(result == expected, true);
 }
 
+// Check the bit-width-detecting MSM against a naive MSM for scalars of various widths, including the 0/1 and the
+// full-width cases
+TYPED_TEST(ScalarMultiplicationTests, PippengerOptimizedForSmallScalars)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 4096;
+
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    std::vector<AffineElement> raw_points(&points[0], &points[num_points]);
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+
+    for (size_t num_bits : { 0, 1, 2, 7, 33, 64, 65, 254 }) {
+        std::vector<Fr> scalars(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            // Leave a third of the scalars zero
+            if (num_bits == 0 || i % 3 == 0) {
+                continue;
+            }
+            uint256_t value = engine.get_random_uint256();
+            if (num_bits < 256) {
+                value &= (uint256_t(1) << num_bits) - 1;
+            }
+            scalars[i] = Fr(value);
+        }
+        // Make sure the top bit is set somewhere
+        if (num_bits > 0 && num_bits < 254) {
+            scalars[1] = Fr(uint256_t(1) << (num_bits - 1));
+        }
+
+        Element expected;
+        expected.self_set_infinity();
+        for (size_t i = 0; i < num_points; ++i) {
+            expected += raw_points[i] * scalars[i];
+        }
+
+        if (num_bits <= scalar_multiplication::SMALL_SCALAR_MAX_BITS) {
+            EXPECT_EQ(scalar_multiplication::get_scalar_bit_width<Curve>(scalars), num_bits);
+        }
+        Element result = scalar_multiplication::pippenger_unsafe_optimized_for_small_scalars<Curve>(
+            scalars, { points.get(), num_points }, state);
+        EXPECT_EQ(AffineElement(result), AffineElement(expected));
+    }
+}
+
 TYPED_TEST(ScalarMultiplicationTests, PippengerOne)
 {
     using Curve = TypeParam;
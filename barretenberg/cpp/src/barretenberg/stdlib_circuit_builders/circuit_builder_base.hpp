@@ -12,6 +12,20 @@
 namespace bb {
 static constexpr uint32_t DUMMY_TAG = 0;
 
+/**
+ * @brief The number of variables and the number of gates in each block of a constructed circuit
+ * @details Taken from a builder once a circuit has been constructed (see `get_size_profile` in the Ultra builders), it
+ * is used to size the storage of a builder constructing the same circuit again, e.g. with a different witness. The
+ * variable vectors and the wires and selectors of every block are then allocated exactly once and never relocated
+ * while the circuit is being built.
+ */
+struct CircuitSizeProfile {
+    size_t num_variables = 0;
+    std::vector<size_t> block_sizes;
+
+    bool operator==(const CircuitSizeProfile& other) const = default;
+};
+
 template <typename FF_> class CircuitBuilderBase {
   public:
     using FF = FF_;
@@ -37,7 +51,7 @@ template <typename FF_> class CircuitBuilderBase {
     std::map<uint32_t, uint32_t> tau;
 
     // Public input indices which contain recursive proof information
-    AggregationObjectPubInputIndices recursive_proof_public_input_indices;
+    AggregationObjectPubInputIndices recursive_proof_public_input_indices = {};
     bool contains_recursive_proof = false;
 
     // We only know from the circuit description whether a circuit should use a prover which produces
@@ -65,6 +79,11 @@ template <typename FF_> class CircuitBuilderBase {
     virtual size_t get_num_gates() const;
     virtual void print_num_gates() const;
     virtual size_t get_num_variables() const;
+
+    /**
+     * @brief Reserve the storage of num_variables variables, including their copy cycle and tag bookkeeping
+     */
+    void reserve_variables(size_t num_variables);
     // TODO(#216)(Adrian): Feels wrong to let the zero_idx be changed.
     uint32_t zero_idx = 0;
     uint32_t one_idx = 1;
@@ -131,6 +150,13 @@ template <typename FF_> class CircuitBuilderBase {
      */
     virtual uint32_t add_variable(const FF& in);
 
+    /**
+     * @brief Add num_variables zero-valued variables at once, e.g. to let their values be set concurrently
+     *
+     * @return The index of the first of the new variables, which occupy consecutive indices
+     */
+    uint32_t add_variables(size_t num_variables);
+
     /**
      * Assign a name to a variable(equivalence class). Should be one name per equivalence class.
      *
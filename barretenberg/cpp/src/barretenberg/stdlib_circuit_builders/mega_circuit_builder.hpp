@@ -54,6 +54,20 @@ template <typename FF> class MegaCircuitBuilder_ : public UltraCircuitBuilder_<M
     MegaCircuitBuilder_(std::shared_ptr<ECCOpQueue> op_queue_in)
         : MegaCircuitBuilder_(0, op_queue_in)
     {}
+    /**
+     * @brief Construct a builder whose storage is sized from a previous construction of the circuit
+     *
+     * @param size_profile The result of get_size_profile() on a builder of the same circuit
+     * @param op_queue_in Op queue to which goblinized group ops will be added
+     */
+    explicit MegaCircuitBuilder_(const CircuitSizeProfile& size_profile,
+                                 std::shared_ptr<ECCOpQueue> op_queue_in = std::make_shared<ECCOpQueue>())
+        : UltraCircuitBuilder_<MegaArith<FF>>(size_profile)
+        , op_queue(op_queue_in)
+    {
+        // Set indices to constants corresponding to Goblin ECC op codes
+        set_goblin_ecc_op_code_constant_variables();
+    };
 
     /**
      * @brief Constructor from data generated from ACIR
@@ -469,7 +469,7 @@ class MegaFlavor {
         void compute_logderivative_inverses(const RelationParameters<FF>& relation_parameters)
         {
             // Compute inverses for conventional lookups
-            LogDerivLookupRelation<FF>::compute_logderivative_inverse(
+            compute_logderivative_inverse<MegaFlavor, LogDerivLookupRelation<FF>>(
                 this->polynomials, relation_parameters, this->circuit_size);
 
             // Compute inverses for calldata reads
@@ -29,12 +29,11 @@ inline std::array<bb::fr, 2> get_xor_rotate_values_from_key(const std::array<uin
  * Generates a basic 32-bit (XOR + ROTR) lookup table.
  */
 template <uint64_t bits_per_slice, uint64_t num_rotated_output_bits, bool filter = false>
-inline BasicTable generate_xor_rotate_table(BasicTableId id, const size_t table_index)
+inline BasicTable generate_xor_rotate_table(BasicTableId id)
 {
     const uint64_t base = 1UL << bits_per_slice;
     BasicTable table;
     table.id = id;
-    table.table_index = table_index;
     table.use_twin_keys = true;
 
     for (uint64_t i = 0; i < base; ++i) {
@@ -177,13 +177,12 @@ constexpr function_ptr_table make_function_pointer_table()
  *
  * @tparam multitable_index , which of our 4 multitables is this basic table a part of?
  * @param id the BasicTableId
- * @param basic_table_index plookup table index
  * @param table_index This index describes which bit-slice the basic table corresponds to. i.e. table_index = 0 maps to
  *                    the least significant bit slice
  * @return BasicTable
  */
 template <size_t multitable_index>
-BasicTable table::generate_basic_fixed_base_table(BasicTableId id, size_t basic_table_index, size_t table_index)
+BasicTable table::generate_basic_fixed_base_table(BasicTableId id, size_t table_index)
 {
     static_assert(multitable_index < NUM_FIXED_BASE_MULTI_TABLES);
     ASSERT(table_index < MAX_NUM_TABLES_IN_MULTITABLE);
@@ -196,7 +195,6 @@ BasicTable table::generate_basic_fixed_base_table(BasicTableId id, size_t basic_
     const auto table_size = static_cast<size_t>(1ULL << table_bits);
     BasicTable table;
     table.id = id;
-    table.table_index = basic_table_index;
     table.use_twin_keys = false;
 
     const auto& basic_table = fixed_base_tables[multitable_index][table_index];
@@ -262,10 +260,10 @@ template table::fixed_base_scalar_mul_tables table::generate_tables<table::BITS_
 template table::fixed_base_scalar_mul_tables table::generate_tables<table::BITS_PER_HI_SCALAR>(
     const table::affine_element& input);
 
-template BasicTable table::generate_basic_fixed_base_table<0>(BasicTableId, size_t, size_t);
-template BasicTable table::generate_basic_fixed_base_table<1>(BasicTableId, size_t, size_t);
-template BasicTable table::generate_basic_fixed_base_table<2>(BasicTableId, size_t, size_t);
-template BasicTable table::generate_basic_fixed_base_table<3>(BasicTableId, size_t, size_t);
+template BasicTable table::generate_basic_fixed_base_table<0>(BasicTableId, size_t);
+template BasicTable table::generate_basic_fixed_base_table<1>(BasicTableId, size_t);
+template BasicTable table::generate_basic_fixed_base_table<2>(BasicTableId, size_t);
+template BasicTable table::generate_basic_fixed_base_table<3>(BasicTableId, size_t);
 template MultiTable table::get_fixed_base_table<0, table::BITS_PER_LO_SCALAR>(MultiTableId);
 template MultiTable table::get_fixed_base_table<1, table::BITS_PER_HI_SCALAR>(MultiTableId);
 template MultiTable table::get_fixed_base_table<2, table::BITS_PER_LO_SCALAR>(MultiTableId);
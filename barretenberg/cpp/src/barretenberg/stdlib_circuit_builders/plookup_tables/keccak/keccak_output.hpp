@@ -82,14 +82,12 @@ class KeccakOutput {
      * @brief Generate plookup table that maps a TABLE_BITS-slice of a base-11 integer into a base-2 integer
      *
      * @param id
-     * @param table_index
      * @return BasicTable
      */
-    static BasicTable generate_keccak_output_table(BasicTableId id, const size_t table_index)
+    static BasicTable generate_keccak_output_table(BasicTableId id)
     {
         BasicTable table;
         table.id = id;
-        table.table_index = table_index;
         table.use_twin_keys = false;
         auto table_size = numeric::pow64(static_cast<uint64_t>(EFFECTIVE_BASE), TABLE_BITS);
 
@@ -177,11 +177,10 @@ std::array<bb::fr, 2> ecc_generator_table<G1>::get_xyprime_endo_values(const std
              ecc_generator_table<G1>::generator_endo_xyprime_table[index].second };
 }
 
-template <typename G1> BasicTable ecc_generator_table<G1>::generate_xlo_table(BasicTableId id, const size_t table_index)
+template <typename G1> BasicTable ecc_generator_table<G1>::generate_xlo_table(BasicTableId id)
 {
     BasicTable table;
     table.id = id;
-    table.table_index = table_index;
     size_t table_size = 256;
     table.use_twin_keys = false;
 
@@ -200,11 +199,10 @@ template <typename G1> BasicTable ecc_generator_table<G1>::generate_xlo_table(Ba
     return table;
 }
 
-template <typename G1> BasicTable ecc_generator_table<G1>::generate_xhi_table(BasicTableId id, const size_t table_index)
+template <typename G1> BasicTable ecc_generator_table<G1>::generate_xhi_table(BasicTableId id)
 {
     BasicTable table;
     table.id = id;
-    table.table_index = table_index;
     size_t table_size = 256;
     table.use_twin_keys = false;
 
@@ -223,12 +221,10 @@ template <typename G1> BasicTable ecc_generator_table<G1>::generate_xhi_table(Ba
     return table;
 }
 
-template <typename G1>
-BasicTable ecc_generator_table<G1>::generate_xlo_endo_table(BasicTableId id, const size_t table_index)
+template <typename G1> BasicTable ecc_generator_table<G1>::generate_xlo_endo_table(BasicTableId id)
 {
     BasicTable table;
     table.id = id;
-    table.table_index = table_index;
     size_t table_size = 256;
     table.use_twin_keys = false;
 
@@ -247,12 +243,10 @@ BasicTable ecc_generator_table<G1>::generate_xlo_endo_table(BasicTableId id, con
     return table;
 }
 
-template <typename G1>
-BasicTable ecc_generator_table<G1>::generate_xhi_endo_table(BasicTableId id, const size_t table_index)
+template <typename G1> BasicTable ecc_generator_table<G1>::generate_xhi_endo_table(BasicTableId id)
 {
     BasicTable table;
     table.id = id;
-    table.table_index = table_index;
     size_t table_size = 256;
     table.use_twin_keys = false;
 
@@ -271,11 +265,10 @@ BasicTable ecc_generator_table<G1>::generate_xhi_endo_table(BasicTableId id, con
     return table;
 }
 
-template <typename G1> BasicTable ecc_generator_table<G1>::generate_ylo_table(BasicTableId id, const size_t table_index)
+template <typename G1> BasicTable ecc_generator_table<G1>::generate_ylo_table(BasicTableId id)
 {
     BasicTable table;
     table.id = id;
-    table.table_index = table_index;
     size_t table_size = 256;
     table.use_twin_keys = false;
 
@@ -294,11 +287,10 @@ template <typename G1> BasicTable ecc_generator_table<G1>::generate_ylo_table(Ba
     return table;
 }
 
-template <typename G1> BasicTable ecc_generator_table<G1>::generate_yhi_table(BasicTableId id, const size_t table_index)
+template <typename G1> BasicTable ecc_generator_table<G1>::generate_yhi_table(BasicTableId id)
 {
     BasicTable table;
     table.id = id;
-    table.table_index = table_index;
     size_t table_size = 256;
     table.use_twin_keys = false;
 
@@ -317,12 +309,10 @@ template <typename G1> BasicTable ecc_generator_table<G1>::generate_yhi_table(Ba
     return table;
 }
 
-template <typename G1>
-BasicTable ecc_generator_table<G1>::generate_xyprime_table(BasicTableId id, const size_t table_index)
+template <typename G1> BasicTable ecc_generator_table<G1>::generate_xyprime_table(BasicTableId id)
 {
     BasicTable table;
     table.id = id;
-    table.table_index = table_index;
     size_t table_size = 256;
     table.use_twin_keys = false;
 
@@ -341,12 +331,10 @@ BasicTable ecc_generator_table<G1>::generate_xyprime_table(BasicTableId id, cons
     return table;
 }
 
-template <typename G1>
-BasicTable ecc_generator_table<G1>::generate_xyprime_endo_table(BasicTableId id, const size_t table_index)
+template <typename G1> BasicTable ecc_generator_table<G1>::generate_xyprime_endo_table(BasicTableId id)
 {
     BasicTable table;
     table.id = id;
-    table.table_index = table_index;
     size_t table_size = 256;
     table.use_twin_keys = false;
 
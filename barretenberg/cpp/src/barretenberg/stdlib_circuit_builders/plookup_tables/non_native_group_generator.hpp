@@ -37,14 +37,14 @@ template <typename G1> class ecc_generator_table {
     static std::array<fr, 2> get_yhi_values(const std::array<uint64_t, 2> key);
     static std::array<fr, 2> get_xyprime_values(const std::array<uint64_t, 2> key);
     static std::array<fr, 2> get_xyprime_endo_values(const std::array<uint64_t, 2> key);
-    static BasicTable generate_xlo_table(BasicTableId id, const size_t table_index);
-    static BasicTable generate_xhi_table(BasicTableId id, const size_t table_index);
-    static BasicTable generate_xlo_endo_table(BasicTableId id, const size_t table_index);
-    static BasicTable generate_xhi_endo_table(BasicTableId id, const size_t table_index);
-    static BasicTable generate_ylo_table(BasicTableId id, const size_t table_index);
-    static BasicTable generate_yhi_table(BasicTableId id, const size_t table_index);
-    static BasicTable generate_xyprime_table(BasicTableId id, const size_t table_index);
-    static BasicTable generate_xyprime_endo_table(BasicTableId id, const size_t table_index);
+    static BasicTable generate_xlo_table(BasicTableId id);
+    static BasicTable generate_xhi_table(BasicTableId id);
+    static BasicTable generate_xlo_endo_table(BasicTableId id);
+    static BasicTable generate_xhi_endo_table(BasicTableId id);
+    static BasicTable generate_ylo_table(BasicTableId id);
+    static BasicTable generate_yhi_table(BasicTableId id);
+    static BasicTable generate_xyprime_table(BasicTableId id);
+    static BasicTable generate_xyprime_endo_table(BasicTableId id);
     static MultiTable get_xlo_table(const MultiTableId id, const BasicTableId basic_id);
     static MultiTable get_xhi_table(const MultiTableId id, const BasicTableId basic_id);
     static MultiTable get_xlo_endo_table(const MultiTableId id, const BasicTableId basic_id);
@@ -11,5 +11,7 @@ ReadData<bb::fr> get_lookup_accumulators(MultiTableId id,
                                          const bb::fr& key_b = 0,
                                          bool is_2_to_1_lookup = false);
 
-BasicTable create_basic_table(BasicTableId id, size_t index);
+BasicTable create_basic_table(BasicTableId id);
+
+const BasicTable& get_basic_table(BasicTableId id);
 } // namespace bb::plookup
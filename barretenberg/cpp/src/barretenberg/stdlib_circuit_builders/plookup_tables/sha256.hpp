@@ -91,20 +91,19 @@ static constexpr uint64_t witness_extension_normalization_table[16]{
     2,
 };
 
-inline plookup::BasicTable generate_witness_extension_normalization_table(BasicTableId id, const size_t table_index)
+inline plookup::BasicTable generate_witness_extension_normalization_table(BasicTableId id)
 {
-    return sparse_tables::generate_sparse_normalization_table<16, 3, witness_extension_normalization_table>(
-        id, table_index);
+    return sparse_tables::generate_sparse_normalization_table<16, 3, witness_extension_normalization_table>(id);
 }
 
-inline BasicTable generate_choose_normalization_table(BasicTableId id, const size_t table_index)
+inline BasicTable generate_choose_normalization_table(BasicTableId id)
 {
-    return sparse_tables::generate_sparse_normalization_table<28, 2, choose_normalization_table>(id, table_index);
+    return sparse_tables::generate_sparse_normalization_table<28, 2, choose_normalization_table>(id);
 }
 
-inline BasicTable generate_majority_normalization_table(BasicTableId id, const size_t table_index)
+inline BasicTable generate_majority_normalization_table(BasicTableId id)
 {
-    return sparse_tables::generate_sparse_normalization_table<16, 3, majority_normalization_table>(id, table_index);
+    return sparse_tables::generate_sparse_normalization_table<16, 3, majority_normalization_table>(id);
 }
 
 inline MultiTable get_witness_extension_output_table(const MultiTableId id = SHA256_WITNESS_OUTPUT)
@@ -73,6 +73,7 @@ enum BasicTableId {
     KECCAK_RHO_7,
     KECCAK_RHO_8,
     KECCAK_RHO_9,
+    NUM_BASIC_TABLES,
 };
 
 enum MultiTableId {
@@ -330,7 +331,8 @@ struct LookupHashTable {
 
 /**
  * @brief A basic table from which we can perform lookups (for example, an xor table)
- * @details Also stores the lookup gate data for all lookups performed on this table
+ * @details The contents only depend on the table id; the data of the lookups a circuit performs on the table is stored
+ * in CircuitBasicTable.
  *
  * @details You can find initialization example at
  * ../ultra_plonk_composer.cpp#UltraPlonkComposer::initialize_precomputed_table(..)
@@ -362,7 +364,6 @@ struct BasicTable {
 
     // Unique id of the table which is used to look it up, when we need its functionality. One of BasicTableId enum
     BasicTableId id;
-    size_t table_index;
     // This means that we are using two inputs to look up stuff, not translate a single entry into another one.
     bool use_twin_keys;
 
@@ -372,7 +373,6 @@ struct BasicTable {
     std::vector<bb::fr> column_1;
     std::vector<bb::fr> column_2;
     std::vector<bb::fr> column_3;
-    std::vector<LookupEntry> lookup_gates; // wire data for all lookup gates created for lookups on this table
 
     // Map from a table entry to its index in the table; used for constructing read counts
     LookupHashTable index_map;
@@ -390,6 +390,34 @@ struct BasicTable {
     }
 };
 
+/**
+ * @brief A basic table as used by a particular circuit
+ * @details The contents of a basic table only depend on its id, so they are generated once per process and shared
+ * read-only by all circuits (see get_basic_table). A circuit only owns the data that is specific to it: the index of
+ * the table within the circuit and the lookups it has performed on the table.
+ */
+struct CircuitBasicTable {
+    const BasicTable* table = nullptr; // the shared, immutable table contents
+    size_t table_index = 0;
+    std::vector<BasicTable::LookupEntry> lookup_gates; // wire data for the lookups performed on this table
+
+    CircuitBasicTable() = default;
+    CircuitBasicTable(const BasicTable& table, const size_t table_index)
+        : table(&table)
+        , table_index(table_index)
+    {}
+
+    BasicTableId id() const { return table->id; }
+    bool use_twin_keys() const { return table->use_twin_keys; }
+    const std::vector<bb::fr>& column_1() const { return table->column_1; }
+    const std::vector<bb::fr>& column_2() const { return table->column_2; }
+    const std::vector<bb::fr>& column_3() const { return table->column_3; }
+    const LookupHashTable& index_map() const { return table->index_map; }
+    size_t size() const { return table->size(); }
+
+    bool operator==(const CircuitBasicTable& other) const = default;
+};
+
 enum ColumnIdx { C1, C2, C3 };
 
 /**
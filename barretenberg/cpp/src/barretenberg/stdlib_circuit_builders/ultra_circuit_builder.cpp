@@ -6,6 +6,7 @@
  *
  */
 #include "ultra_circuit_builder.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/crypto/poseidon2/poseidon2_params.hpp"
 #include <barretenberg/plonk/proof_system/constants.hpp>
 #include <unordered_map>
@@ -693,18 +694,18 @@ uint32_t UltraCircuitBuilder_<Arithmetization>::put_constant_variable(const FF&
  *
  * @tparam Arithmetization
  * @param id
- * @return plookup::BasicTable&
+ * @return plookup::CircuitBasicTable&
  */
 template <typename Arithmetization>
-plookup::BasicTable& UltraCircuitBuilder_<Arithmetization>::get_table(const plookup::BasicTableId id)
+plookup::CircuitBasicTable& UltraCircuitBuilder_<Arithmetization>::get_table(const plookup::BasicTableId id)
 {
-    for (plookup::BasicTable& table : lookup_tables) {
-        if (table.id == id) {
+    for (plookup::CircuitBasicTable& table : lookup_tables) {
+        if (table.id() == id) {
             return table;
         }
     }
-    // Table doesn't exist! So try to create it.
-    lookup_tables.emplace_back(plookup::create_basic_table(id, lookup_tables.size()));
+    // Table isn't used by the circuit yet! So add a reference to the shared instance.
+    lookup_tables.emplace_back(plookup::get_basic_table(id), lookup_tables.size());
     return lookup_tables.back();
 }
 
@@ -966,7 +967,13 @@ void UltraCircuitBuilder_<Arithmetization>::create_new_range_constraint(const ui
     }
 }
 
-template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_range_list(RangeList& list)
+/**
+ * @brief Canonicalize the variables of a range list and return their values in sorted order
+ * @details Only reads the variables of the builder (and writes the list itself), so distinct lists can be sorted
+ * concurrently.
+ */
+template <typename Arithmetization>
+std::vector<uint32_t> UltraCircuitBuilder_<Arithmetization>::sort_range_list(RangeList& list)
 {
     this->assert_valid_variables(list.variable_indices);
 
@@ -999,16 +1006,32 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
 #else
     std::sort(std::execution::par_unseq, sorted_list.begin(), sorted_list.end());
 #endif
-    // list must be padded to a multipe of 4 and larger than 4 (gate_width)
+    return sorted_list;
+}
+
+/**
+ * @brief The number of zero_idx entries that pad a sorted range list of the given size to a whole number of gates
+ * @details The list must be padded to a multiple of the gate width and be larger than the gate width
+ */
+template <typename Arithmetization>
+size_t UltraCircuitBuilder_<Arithmetization>::get_range_list_padding(const size_t list_size)
+{
     constexpr size_t gate_width = NUM_WIRES;
-    size_t padding = (gate_width - (list.variable_indices.size() % gate_width)) % gate_width;
+    size_t padding = (gate_width - (list_size % gate_width)) % gate_width;
+    if (list_size <= gate_width) {
+        padding += gate_width;
+    }
+    return padding;
+}
+
+template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_range_list(RangeList& list)
+{
+    const auto sorted_list = sort_range_list(list);
+    const size_t padding = get_range_list_padding(sorted_list.size());
 
     std::vector<uint32_t> indices;
     indices.reserve(padding + sorted_list.size());
 
-    if (list.variable_indices.size() <= gate_width) {
-        padding += gate_width;
-    }
     for (size_t i = 0; i < padding; ++i) {
         indices.emplace_back(this->zero_idx);
     }
@@ -1020,11 +1043,90 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
     create_sort_constraint_with_edges(indices, 0, list.target_range);
 }
 
+/**
+ * @brief Add the sort constraints of all range lists
+ * @details The range lists are independent of each other, so they are processed in two concurrent passes. The first
+ * sorts the values of every list. The number of variables and gates each list adds only depends on its size, so the
+ * variables and the arithmetic and delta range blocks are then grown once and the second pass writes the variables and
+ * gates of every list into its own slice. The result is identical to calling process_range_list on each list in turn.
+ */
 template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_range_lists()
 {
-    for (auto& i : range_lists) {
-        process_range_list(i.second);
-    }
+    constexpr size_t gate_width = NUM_WIRES;
+
+    std::vector<RangeList*> lists;
+    lists.reserve(range_lists.size());
+    for (auto& [target_range, list] : range_lists) {
+        lists.emplace_back(&list);
+    }
+    const size_t num_lists = lists.size();
+
+    std::vector<std::vector<uint32_t>> sorted_lists(num_lists);
+    parallel_for(num_lists, [&](size_t i) { sorted_lists[i] = sort_range_list(*lists[i]); });
+
+    // Each list adds one variable per sorted value, two arithmetic gates enforcing its edges and, in the delta range
+    // block, one sort gate per gate_width (padded) values followed by a dummy gate
+    std::vector<uint32_t> variable_offsets(num_lists);
+    std::vector<size_t> delta_range_offsets(num_lists);
+    size_t num_new_variables = 0;
+    size_t num_delta_range_gates = 0;
+    for (size_t i = 0; i < num_lists; ++i) {
+        variable_offsets[i] = static_cast<uint32_t>(num_new_variables);
+        delta_range_offsets[i] = num_delta_range_gates;
+        const size_t list_size = sorted_lists[i].size();
+        num_new_variables += list_size;
+        num_delta_range_gates += (get_range_list_padding(list_size) + list_size) / gate_width + 1;
+    }
+
+    const uint32_t first_new_variable = this->add_variables(num_new_variables);
+    const size_t arithmetic_start = blocks.arithmetic.size();
+    const size_t delta_range_start = blocks.delta_range.size();
+    blocks.arithmetic.resize(arithmetic_start + 2 * num_lists);
+    blocks.delta_range.resize(delta_range_start + num_delta_range_gates);
+    this->num_gates += 2 * num_lists + num_delta_range_gates;
+
+    const uint32_t zero_idx = this->zero_idx;
+    auto set_wires = [](auto& block, size_t row, uint32_t idx_1, uint32_t idx_2, uint32_t idx_3, uint32_t idx_4) {
+        block.w_l()[row] = idx_1;
+        block.w_r()[row] = idx_2;
+        block.w_o()[row] = idx_3;
+        block.w_4()[row] = idx_4;
+    };
+    // Mirrors create_add_gate({ variable_index, zero_idx, zero_idx, 1, 0, 0, -value })
+    auto set_edge_gate = [&](size_t row, uint32_t variable_index, const FF& value) {
+        auto& block = blocks.arithmetic;
+        set_wires(block, row, variable_index, zero_idx, zero_idx, zero_idx);
+        block.q_1()[row] = 1;
+        block.q_c()[row] = -value;
+        block.q_arith()[row] = 1;
+    };
+
+    parallel_for(num_lists, [&](size_t i) {
+        const auto& sorted_list = sorted_lists[i];
+        const size_t padding = get_range_list_padding(sorted_list.size());
+
+        std::vector<uint32_t> indices(padding, zero_idx);
+        indices.reserve(padding + sorted_list.size());
+        for (size_t j = 0; j < sorted_list.size(); ++j) {
+            const uint32_t index = first_new_variable + variable_offsets[i] + static_cast<uint32_t>(j);
+            this->variables[index] = sorted_list[j];
+            this->real_variable_tags[index] = lists[i]->tau_tag;
+            indices.emplace_back(index);
+        }
+
+        // The gates of create_sort_constraint_with_edges(indices, 0, target_range)
+        const uint32_t last_index = indices.back();
+        set_edge_gate(arithmetic_start + 2 * i, indices[0], 0);
+        size_t row = delta_range_start + delta_range_offsets[i];
+        for (size_t j = 0; j < indices.size(); j += gate_width) {
+            set_wires(blocks.delta_range, row, indices[j], indices[j + 1], indices[j + 2], indices[j + 3]);
+            blocks.delta_range.q_delta_range()[row] = 1;
+            row++;
+        }
+        set_wires(blocks.delta_range, row, last_index, zero_idx, zero_idx, zero_idx); // dummy gate
+        set_edge_gate(arithmetic_start + 2 * i + 1, last_index, lists[i]->target_range);
+    });
+    check_selector_length_consistency();
 }
 
 /*
@@ -2576,11 +2678,7 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
         }
     }
 
-#ifdef NO_TBB
-    std::sort(rom_array.records.begin(), rom_array.records.end());
-#else
-    std::sort(std::execution::par_unseq, rom_array.records.begin(), rom_array.records.end());
-#endif
+    sort_memory_records(rom_array.records);
 
     for (const RomRecord& record : rom_array.records) {
         const auto index = record.index;
@@ -2668,11 +2766,7 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
         }
     }
 
-#ifdef NO_TBB
-    std::sort(ram_array.records.begin(), ram_array.records.end());
-#else
-    std::sort(std::execution::par_unseq, ram_array.records.begin(), ram_array.records.end());
-#endif
+    sort_memory_records(ram_array.records);
 
     std::vector<RamRecord> sorted_ram_records;
 
@@ -2780,14 +2874,35 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
     }
 }
 
+/**
+ * @brief Sort a vector of ROM or RAM records, only sorting the records that follow its longest sorted prefix
+ * @details process_ROM_arrays and process_RAM_arrays sort the records of all arrays concurrently up front, after which
+ * only the records of the cells initialized in process_ROM_array/process_RAM_array have to be merged in.
+ */
+template <typename Arithmetization>
+template <typename Record>
+void UltraCircuitBuilder_<Arithmetization>::sort_memory_records(std::vector<Record>& records)
+{
+    auto sorted_end = std::is_sorted_until(records.begin(), records.end());
+#ifdef NO_TBB
+    std::sort(sorted_end, records.end());
+#else
+    std::sort(std::execution::par_unseq, sorted_end, records.end());
+#endif
+    std::inplace_merge(records.begin(), sorted_end, records.end());
+}
+
 template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_ROM_arrays()
 {
+    // The arrays are independent, so their records can be sorted concurrently; the gates are then added in order
+    parallel_for(rom_arrays.size(), [&](size_t i) { sort_memory_records(rom_arrays[i].records); });
     for (size_t i = 0; i < rom_arrays.size(); ++i) {
         process_ROM_array(i);
     }
 }
 template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_RAM_arrays()
 {
+    parallel_for(ram_arrays.size(), [&](size_t i) { sort_memory_records(ram_arrays[i].records); });
     for (size_t i = 0; i < ram_arrays.size(); ++i) {
         process_RAM_array(i);
     }
@@ -2964,7 +3079,7 @@ template <typename Arithmetization> msgpack::sbuffer UltraCircuitBuilder_<Arithm
         info("Table no: ", table.table_index);
         std::vector<std::vector<FF>> tmp_table;
         for (size_t i = 0; i < table.size(); ++i) {
-            tmp_table.push_back({ table.column_1[i], table.column_2[i], table.column_3[i] });
+            tmp_table.push_back({ table.column_1()[i], table.column_2()[i], table.column_3()[i] });
         }
         cir.lookup_tables.push_back(tmp_table);
     }
@@ -11,7 +11,9 @@
 
 // TODO(md): note that this has now been added
 #include "circuit_builder_base.hpp"
+#include <numeric>
 #include <optional>
+#include <tuple>
 #include <unordered_set>
 
 #include "barretenberg/serialize/cbind.hpp"
@@ -212,19 +214,31 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
             return valid;
         }
 
+        /**
+         * @brief Remove all but the first occurrence of every multiplication, keeping the first occurrences in order
+         * @details Sorts a permutation of the multiplications rather than hashing them into a set. Ties are broken by
+         * position, so the first occurrence of every run of equal multiplications is the one kept.
+         */
         static void deduplicate(std::vector<cached_partial_non_native_field_multiplication>& vec)
         {
-            std::unordered_set<cached_partial_non_native_field_multiplication, Hash, std::equal_to<>> seen;
+            std::vector<uint32_t> order(vec.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::sort(order.begin(), order.end(), [&](uint32_t lhs, uint32_t rhs) {
+                return std::tie(vec[lhs].a, vec[lhs].b, lhs) < std::tie(vec[rhs].a, vec[rhs].b, rhs);
+            });
 
-            std::vector<cached_partial_non_native_field_multiplication> uniqueVec;
+            std::vector<bool> is_duplicate(vec.size(), false);
+            for (size_t i = 1; i < order.size(); ++i) {
+                is_duplicate[order[i]] = vec[order[i]] == vec[order[i - 1]];
+            }
 
-            for (const auto& item : vec) {
-                if (seen.insert(item).second) {
-                    uniqueVec.push_back(item);
+            size_t num_unique = 0;
+            for (size_t i = 0; i < vec.size(); ++i) {
+                if (!is_duplicate[i]) {
+                    vec[num_unique++] = vec[i];
                 }
             }
-
-            vec.swap(uniqueVec);
+            vec.resize(num_unique);
         }
 
         bool operator<(const cached_partial_non_native_field_multiplication& other) const
@@ -240,31 +254,6 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
             }
             return other.b < b;
         }
-
-        struct Hash {
-            size_t operator()(const cached_partial_non_native_field_multiplication& obj) const
-            {
-                size_t combined_hash = 0;
-
-                // C++ does not have a standard way to hash values, so we use the
-                // common algorithm that boot uses.
-                // You can search for 'cpp hash_combine' to find more information.
-                // Here is one reference:
-                // https://stackoverflow.com/questions/2590677/how-do-i-combine-hash-values-in-c0x
-                auto hash_combiner = [](size_t lhs, size_t rhs) {
-                    return lhs ^ (rhs + 0x9e3779b9 + (lhs << 6) + (lhs >> 2));
-                };
-
-                for (const auto& elem : obj.a) {
-                    combined_hash = hash_combiner(combined_hash, std::hash<uint32_t>()(elem));
-                }
-                for (const auto& elem : obj.b) {
-                    combined_hash = hash_combiner(combined_hash, std::hash<uint32_t>()(elem));
-                }
-
-                return combined_hash;
-            }
-        };
     };
 
     struct non_native_field_multiplication_cross_terms {
@@ -284,8 +273,9 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     // TODO(#216)(Adrian): Why is this not in CircuitBuilderBase
     std::map<FF, uint32_t> constant_variable_indices;
 
-    // The set of lookup tables used by the circuit, plus the gate data for the lookups from each table
-    std::vector<plookup::BasicTable> lookup_tables;
+    // The set of lookup tables used by the circuit, plus the gate data for the lookups from each table. The table
+    // contents are shared by all circuits (see plookup::get_basic_table)
+    std::vector<plookup::CircuitBasicTable> lookup_tables;
 
     std::map<uint64_t, RangeList> range_lists; // DOCTODO: explain this.
 
@@ -323,6 +313,19 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
         this->zero_idx = put_constant_variable(FF::zero());
         this->tau.insert({ DUMMY_TAG, DUMMY_TAG }); // TODO(luke): explain this
     };
+    /**
+     * @brief Construct a builder whose variable and block storage is sized from a previous construction of the circuit
+     * @details As long as the circuit does not outgrow the profile, none of the variable vectors and none of the block
+     * wires and selectors is reallocated (and hence copied) during construction, including finalization.
+     *
+     * @param size_profile The result of get_size_profile() on a builder of the same circuit
+     */
+    explicit UltraCircuitBuilder_(const CircuitSizeProfile& size_profile)
+    {
+        reserve(size_profile);
+        this->zero_idx = put_constant_variable(FF::zero());
+        this->tau.insert({ DUMMY_TAG, DUMMY_TAG }); // TODO(luke): explain this
+    };
     /**
      * @brief Constructor from data generated from ACIR
      *
@@ -367,32 +370,34 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     UltraCircuitBuilder_(UltraCircuitBuilder_&& other)
         : CircuitBuilderBase<FF>(std::move(other))
     {
-        blocks = other.blocks;
-        constant_variable_indices = other.constant_variable_indices;
-
-        lookup_tables = other.lookup_tables;
-        range_lists = other.range_lists;
-        ram_arrays = other.ram_arrays;
-        rom_arrays = other.rom_arrays;
-        memory_read_records = other.memory_read_records;
-        memory_write_records = other.memory_write_records;
-        cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
+        blocks = std::move(other.blocks);
+        constant_variable_indices = std::move(other.constant_variable_indices);
+
+        lookup_tables = std::move(other.lookup_tables);
+        range_lists = std::move(other.range_lists);
+        ram_arrays = std::move(other.ram_arrays);
+        rom_arrays = std::move(other.rom_arrays);
+        memory_read_records = std::move(other.memory_read_records);
+        memory_write_records = std::move(other.memory_write_records);
+        cached_partial_non_native_field_multiplications =
+            std::move(other.cached_partial_non_native_field_multiplications);
         circuit_finalized = other.circuit_finalized;
     };
     UltraCircuitBuilder_& operator=(const UltraCircuitBuilder_& other) = default;
     UltraCircuitBuilder_& operator=(UltraCircuitBuilder_&& other)
     {
         CircuitBuilderBase<FF>::operator=(std::move(other));
-        blocks = other.blocks;
-        constant_variable_indices = other.constant_variable_indices;
-
-        lookup_tables = other.lookup_tables;
-        range_lists = other.range_lists;
-        ram_arrays = other.ram_arrays;
-        rom_arrays = other.rom_arrays;
-        memory_read_records = other.memory_read_records;
-        memory_write_records = other.memory_write_records;
-        cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
+        blocks = std::move(other.blocks);
+        constant_variable_indices = std::move(other.constant_variable_indices);
+
+        lookup_tables = std::move(other.lookup_tables);
+        range_lists = std::move(other.range_lists);
+        ram_arrays = std::move(other.ram_arrays);
+        rom_arrays = std::move(other.rom_arrays);
+        memory_read_records = std::move(other.memory_read_records);
+        memory_write_records = std::move(other.memory_write_records);
+        cached_partial_non_native_field_multiplications =
+            std::move(other.cached_partial_non_native_field_multiplications);
         circuit_finalized = other.circuit_finalized;
         return *this;
     };
@@ -611,6 +616,36 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
         return count + romcount + ramcount + rangecount + nnfcount;
     }
 
+    /**
+     * @brief Record the number of variables and the size of each block, e.g. to presize a builder constructing the
+     * same circuit again
+     * @note Best taken once the circuit has been finalized (or its trace populated), so that the finalization gates are
+     * accounted for
+     */
+    CircuitSizeProfile get_size_profile()
+    {
+        CircuitSizeProfile size_profile{ .num_variables = this->variables.size(), .block_sizes = {} };
+        for (auto& block : blocks.get()) {
+            size_profile.block_sizes.push_back(block.size());
+        }
+        return size_profile;
+    }
+
+    /**
+     * @brief Reserve the variable storage and the wires and selectors of every block according to a size profile
+     */
+    void reserve(const CircuitSizeProfile& size_profile)
+    {
+        this->reserve_variables(size_profile.num_variables);
+        size_t block_idx = 0;
+        for (auto& block : blocks.get()) {
+            if (block_idx < size_profile.block_sizes.size()) {
+                block.reserve(size_profile.block_sizes[block_idx]);
+            }
+            block_idx++;
+        }
+    }
+
     /**
      * @brief Dynamically compute the number of gates added by the "add_gates_to_ensure_all_polys_are_non_zero" method
      * @note This does NOT add the gates to the present builder
@@ -705,7 +740,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
                                       bool (*generator)(std::vector<FF>&, std::vector<FF>&, std::vector<FF>&),
                                       std::array<FF, 2> (*get_values_from_key)(const std::array<uint64_t, 2>));
 
-    plookup::BasicTable& get_table(const plookup::BasicTableId id);
+    plookup::CircuitBasicTable& get_table(const plookup::BasicTableId id);
     plookup::MultiTable& get_multitable(const plookup::MultiTableId id);
 
     plookup::ReadData<uint32_t> create_gates_from_plookup_accumulators(
@@ -755,6 +790,8 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     }
 
     RangeList create_range_list(const uint64_t target_range);
+    std::vector<uint32_t> sort_range_list(RangeList& list);
+    static size_t get_range_list_padding(size_t list_size);
     void process_range_list(RangeList& list);
     void process_range_lists();
 
@@ -803,6 +840,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     std::array<uint32_t, 2> read_ROM_array_pair(const size_t rom_id, const uint32_t index_witness);
     void create_ROM_gate(RomRecord& record);
     void create_sorted_ROM_gate(RomRecord& record);
+    template <typename Record> static void sort_memory_records(std::vector<Record>& records);
     void process_ROM_array(const size_t rom_id);
     void process_ROM_arrays();
 
@@ -48,35 +48,15 @@ template <class Flavor> class ProverInstance_ {
                     std::shared_ptr<typename Flavor::CommitmentKey> commitment_key = nullptr)
     {
         BB_OP_COUNT_TIME_NAME("ProverInstance(Circuit&)");
-        circuit.add_gates_to_ensure_all_polys_are_non_zero();
-        circuit.finalize_circuit();
-        info("finalized gate count: ", circuit.num_gates);
+        finalize_circuit(circuit, trace_structure);
 
-        // Set flag indicating whether the polynomials will be constructed with fixed block sizes for each gate type
-        const bool is_structured = (trace_structure != TraceStructure::NONE);
-
-        // If using a structured trace, set fixed block sizes, check their validity, and set the dyadic circuit size
-        if (is_structured) {
-            circuit.blocks.set_fixed_block_sizes(trace_structure); // set the fixed sizes for each block
-            circuit.blocks.check_within_fixed_sizes();             // ensure that no block exceeds its fixed size
-            dyadic_circuit_size = compute_structured_dyadic_size(circuit); // set the dyadic size accordingly
-        } else {
-            dyadic_circuit_size = compute_dyadic_size(circuit); // set dyadic size directly from circuit block sizes
-        }
-
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/905): This is adding ops to the op queue but NOT to
-        // the circuit, meaning the ECCVM/Translator will use different ops than the main circuit. This will lead to
-        // failure once https://github.com/AztecProtocol/barretenberg/issues/746 is resolved.
-        if constexpr (IsGoblinFlavor<Flavor>) {
-            circuit.op_queue->append_nonzero_ops();
-        }
         {
             ZoneScopedN("constructing proving key");
             proving_key = ProvingKey(dyadic_circuit_size, circuit.public_inputs.size(), commitment_key);
         }
 
         // Construct and add to proving key the wire, selector and copy constraint polynomials
-        Trace::populate(circuit, proving_key, is_structured);
+        Trace::populate(circuit, proving_key, is_structured(trace_structure));
         ZoneScopedN("constructing prover instance after trace populate");
 
         // If Goblin, construct the databus polynomials
@@ -90,6 +70,81 @@ template <class Flavor> class ProverInstance_ {
 
         construct_lookup_table_polynomials<Flavor>(proving_key.polynomials.get_tables(), circuit, dyadic_circuit_size);
 
+        construct_witness_dependent_data(circuit);
+    }
+
+    /**
+     * @brief Construct an instance from a circuit and a proving key whose precomputed polynomials (selectors,
+     * sigmas/ids, lookup tables, lagrange polynomials) have already been populated, e.g. from a key cache
+     * @details Only the witness-dependent polynomials are computed from the circuit, so this skips selector
+     * population, the permutation mapping and the lookup table construction. The precomputed polynomials must have
+     * been produced from the same circuit description with the same trace structure.
+     */
+    ProverInstance_(Circuit& circuit,
+                    ProvingKey&& precomputed_proving_key,
+                    TraceStructure trace_structure = TraceStructure::NONE)
+    {
+        BB_OP_COUNT_TIME_NAME("ProverInstance(Circuit&, ProvingKey&&)");
+        finalize_circuit(circuit, trace_structure);
+
+        if (precomputed_proving_key.circuit_size != dyadic_circuit_size ||
+            precomputed_proving_key.num_public_inputs != circuit.public_inputs.size()) {
+            throw_or_abort("ProverInstance: precomputed proving key does not match the circuit");
+        }
+        proving_key = std::move(precomputed_proving_key);
+
+        Trace::populate_wires(circuit, proving_key, is_structured(trace_structure));
+
+        if constexpr (IsGoblinFlavor<Flavor>) {
+            construct_databus_polynomials(circuit);
+        }
+
+        construct_witness_dependent_data(circuit);
+    }
+
+    ProverInstance_() = default;
+    ~ProverInstance_() = default;
+
+  private:
+    static constexpr size_t num_zero_rows = Flavor::has_zero_row ? 1 : 0;
+    static constexpr size_t NUM_WIRES = Circuit::NUM_WIRES;
+    size_t dyadic_circuit_size = 0; // final power-of-2 circuit size
+
+    size_t compute_dyadic_size(Circuit&);
+
+    static bool is_structured(TraceStructure trace_structure) { return trace_structure != TraceStructure::NONE; }
+
+    /**
+     * @brief Finalize the circuit and set the dyadic circuit size, using fixed block sizes if the trace is structured
+     */
+    void finalize_circuit(Circuit& circuit, TraceStructure trace_structure)
+    {
+        circuit.add_gates_to_ensure_all_polys_are_non_zero();
+        circuit.finalize_circuit();
+        info("finalized gate count: ", circuit.num_gates);
+
+        // If using a structured trace, set fixed block sizes, check their validity, and set the dyadic circuit size
+        if (is_structured(trace_structure)) {
+            circuit.blocks.set_fixed_block_sizes(trace_structure); // set the fixed sizes for each block
+            circuit.blocks.check_within_fixed_sizes();             // ensure that no block exceeds its fixed size
+            dyadic_circuit_size = compute_structured_dyadic_size(circuit); // set the dyadic size accordingly
+        } else {
+            dyadic_circuit_size = compute_dyadic_size(circuit); // set dyadic size directly from circuit block sizes
+        }
+
+        // TODO(https://github.com/AztecProtocol/barretenberg/issues/905): This is adding ops to the op queue but NOT to
+        // the circuit, meaning the ECCVM/Translator will use different ops than the main circuit. This will lead to
+        // failure once https://github.com/AztecProtocol/barretenberg/issues/746 is resolved.
+        if constexpr (IsGoblinFlavor<Flavor>) {
+            circuit.op_queue->append_nonzero_ops();
+        }
+    }
+
+    /**
+     * @brief Populate the lookup read counts, public inputs and recursion/databus metadata once the wires are set
+     */
+    void construct_witness_dependent_data(Circuit& circuit)
+    {
         construct_lookup_read_counts<Flavor>(proving_key.polynomials.lookup_read_counts,
                                              proving_key.polynomials.lookup_read_tags,
                                              circuit,
@@ -112,16 +167,6 @@ template <class Flavor> class ProverInstance_ {
         }
     }
 
-    ProverInstance_() = default;
-    ~ProverInstance_() = default;
-
-  private:
-    static constexpr size_t num_zero_rows = Flavor::has_zero_row ? 1 : 0;
-    static constexpr size_t NUM_WIRES = Circuit::NUM_WIRES;
-    size_t dyadic_circuit_size = 0; // final power-of-2 circuit size
-
-    size_t compute_dyadic_size(Circuit&);
-
     /**
      * @brief Compute dyadic size based on a structured trace with fixed block size
      *
@@ -5,6 +5,7 @@
 #include "barretenberg/sumcheck/sumcheck_output.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 #include "sumcheck_round.hpp"
+#include <functional>
 
 namespace bb {
 
@@ -170,6 +171,21 @@ template <typename Flavor> class SumcheckProver {
     * TODO(#224)(Cody): might want to just do C-style multidimensional array? for guaranteed adjacency?
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
+    /**
+     * @brief Whether to partially evaluate at each challenge while computing the next round univariate
+     * @details In the default mode, every round writes the table of the next round in partially_evaluate, and the next
+     * round reads it back from memory. In the fused mode the table of each round is computed by \ref
+     * bb::SumcheckProverRound::compute_univariate_and_partially_evaluate "compute_univariate_and_partially_evaluate",
+     * in the same pass as the round univariate, which saves reading it back. The first fused round reads the prover
+     * polynomials; later rounds alternate between partially_evaluated_polynomials and fused_partial_evaluation_buffer,
+     * as a round cannot overwrite the table it reads from.
+     */
+    bool fused_partial_evaluation = false;
+    // The tables of the even rounds in the fused mode, of n/4 rows
+    PartiallyEvaluatedMultivariates fused_partial_evaluation_buffer;
+    // Called once the prover polynomials have been read for the last time, e.g. to page them out of memory until the
+    // PCS rounds, see ProverMemoryBudget
+    std::function<void()> on_prover_polynomials_consumed;
     // prover instantiates sumcheck with circuit size and a prover transcript
     SumcheckProver(size_t multivariate_n, const std::shared_ptr<Transcript>& transcript)
         : multivariate_n(multivariate_n)
@@ -229,7 +245,10 @@ template <typename Flavor> class SumcheckProver {
             FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_0");
             multivariate_challenge.emplace_back(round_challenge);
             // Prepare sumcheck book-keeping table for the next round
-            partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+            if (!fused_partial_evaluation) {
+                partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+                prover_polynomials_consumed();
+            }
             // Prepare ZK Sumcheck data for the next round
             if constexpr (Flavor::HasZK) {
                 update_zk_sumcheck_data(zk_sumcheck_data, round_challenge, round_idx);
@@ -239,21 +258,38 @@ template <typename Flavor> class SumcheckProver {
                                                       // release memory?        // All but final round
                                                       // We operate on partially_evaluated_polynomials in place.
         }
+        if (fused_partial_evaluation && multivariate_d > 2) {
+            fused_partial_evaluation_buffer = PartiallyEvaluatedMultivariates(multivariate_n / 2);
+        }
         for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
             ZoneScopedN("sumcheck loop");
             // Write the round univariate to the transcript
-            round_univariate = round.compute_univariate(round_idx,
-                                                        partially_evaluated_polynomials,
-                                                        relation_parameters,
-                                                        gate_separators,
-                                                        alpha,
-                                                        zk_sumcheck_data);
+            if (fused_partial_evaluation) {
+                round_univariate = compute_fused_round_univariate(round_idx,
+                                                                  full_polynomials,
+                                                                  multivariate_challenge.back(),
+                                                                  relation_parameters,
+                                                                  gate_separators,
+                                                                  alpha);
+                if (round_idx == 1) {
+                    prover_polynomials_consumed();
+                }
+            } else {
+                round_univariate = round.compute_univariate(round_idx,
+                                                            partially_evaluated_polynomials,
+                                                            relation_parameters,
+                                                            gate_separators,
+                                                            alpha,
+                                                            zk_sumcheck_data);
+            }
             // Place evaluations of Sumcheck Round Univariate in the transcript
             transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
             FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
             multivariate_challenge.emplace_back(round_challenge);
             // Prepare sumcheck book-keeping table for the next round
-            partially_evaluate(partially_evaluated_polynomials, round.round_size, round_challenge);
+            if (!fused_partial_evaluation) {
+                partially_evaluate(partially_evaluated_polynomials, round.round_size, round_challenge);
+            }
             // Prepare evaluation masking and libra structures for the next round (for ZK Flavors)
             if constexpr (Flavor::HasZK) {
                 update_zk_sumcheck_data(zk_sumcheck_data, round_challenge, round_idx);
@@ -262,6 +298,15 @@ template <typename Flavor> class SumcheckProver {
             gate_separators.partially_evaluate(round_challenge);
             round.round_size = round.round_size >> 1;
         }
+        // In the fused mode, the table of the last round is yet to be evaluated at its challenge
+        if (fused_partial_evaluation) {
+            if (multivariate_d == 1) {
+                partially_evaluate(full_polynomials, 2, multivariate_challenge.back());
+                prover_polynomials_consumed();
+            } else {
+                partially_evaluate(fused_table(multivariate_d - 1), 2, multivariate_challenge.back());
+            }
+        }
         // Check that the challenges \f$ u_0,\ldots, u_{d-1} \f$ do not satisfy the equation \f$ u_0(1-u_0) + \ldots +
         // u_{d-1} (1 - u_{d-1}) = 0 \f$. This equation is satisfied with probability ~ 1/|FF|, in such cases the prover
         // has to abort and start ZK Sumcheck anew.
@@ -357,6 +402,52 @@ template <typename Flavor> class SumcheckProver {
         });
     };
 
+    void prover_polynomials_consumed()
+    {
+        if (on_prover_polynomials_consumed) {
+            on_prover_polynomials_consumed();
+        }
+    }
+
+    /**
+     * @brief The table of a round after the first in the fused mode, see fused_partial_evaluation
+     */
+    PartiallyEvaluatedMultivariates& fused_table(size_t round_idx)
+    {
+        return round_idx % 2 == 1 ? partially_evaluated_polynomials : fused_partial_evaluation_buffer;
+    }
+
+    /**
+     * @brief In the fused mode, compute the univariate of a round after the first, and its table from the table of the
+     * previous round
+     */
+    SumcheckRoundUnivariate compute_fused_round_univariate(size_t round_idx,
+                                                           ProverPolynomials& full_polynomials,
+                                                           const FF& previous_challenge,
+                                                           const bb::RelationParameters<FF>& relation_parameters,
+                                                           const bb::GateSeparatorPolynomial<FF>& gate_separators,
+                                                           const RelationSeparator alpha)
+    {
+        if (round_idx == 1) {
+            return round.compute_univariate_and_partially_evaluate(round_idx,
+                                                                   full_polynomials,
+                                                                   previous_challenge,
+                                                                   fused_table(round_idx),
+                                                                   relation_parameters,
+                                                                   gate_separators,
+                                                                   alpha,
+                                                                   zk_sumcheck_data);
+        }
+        return round.compute_univariate_and_partially_evaluate(round_idx,
+                                                               fused_table(round_idx - 1),
+                                                               previous_challenge,
+                                                               fused_table(round_idx),
+                                                               relation_parameters,
+                                                               gate_separators,
+                                                               alpha,
+                                                               zk_sumcheck_data);
+    }
+
     /**
     * @brief This method takes the book-keeping table containing partially evaluated prover polynomials and creates a
     * vector containing the evaluations of all prover polynomials at the point \f$ (u_0, \ldots, u_{d-1} )\f$.
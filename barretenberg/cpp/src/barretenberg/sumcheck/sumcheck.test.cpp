@@ -161,6 +161,43 @@ template <typename Flavor> class SumcheckTests : public ::testing::Test {
         }
     }
 
+    /**
+     * @brief Check that partially evaluating inside of the round computations gives the same proof, for both engines
+     */
+    void test_fused_partial_evaluation()
+    {
+        const size_t multivariate_d(7);
+        const size_t multivariate_n(1 << multivariate_d);
+
+        std::vector<Polynomial<FF>> random_polynomials(NUM_POLYNOMIALS);
+        for (auto& poly : random_polynomials) {
+            poly = random_poly(multivariate_n);
+        }
+        auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+        auto relation_parameters = RelationParameters<FF>::get_random();
+        RelationSeparator alpha;
+        for (auto& alpha_i : alpha) {
+            alpha_i = FF::random_element();
+        }
+        std::vector<FF> gate_challenges(multivariate_d);
+        for (auto& gate_challenge : gate_challenges) {
+            gate_challenge = FF::random_element();
+        }
+
+        auto prove = [&](bool fused, typename SumcheckProverRound<Flavor>::Engine engine) {
+            auto transcript = Flavor::Transcript::prover_init_empty();
+            auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
+            sumcheck.fused_partial_evaluation = fused;
+            sumcheck.round.engine = engine;
+            auto output = sumcheck.prove(full_polynomials, relation_parameters, alpha, gate_challenges);
+            return std::make_pair(output.claimed_evaluations.get_all()[0], transcript->proof_data);
+        };
+        using Engine = typename SumcheckProverRound<Flavor>::Engine;
+        auto expected = prove(false, Engine::ROW_MAJOR);
+        EXPECT_EQ(prove(true, Engine::ROW_MAJOR), expected);
+        EXPECT_EQ(prove(true, Engine::COLUMN_MAJOR), expected);
+    }
+
     // TODO(#225): make the inputs to this test more interesting, e.g. non-trivial permutations
     void test_prover_verifier_flow()
     {
@@ -345,6 +382,11 @@ TYPED_TEST(SumcheckTests, Prover)
 {
     this->test_prover();
 }
+TYPED_TEST(SumcheckTests, FusedPartialEvaluation)
+{
+    SKIP_IF_ZK();
+    this->test_fused_partial_evaluation();
+}
 // Tests the prover-verifier flow
 TYPED_TEST(SumcheckTests, ProverAndVerifierSimple)
 {
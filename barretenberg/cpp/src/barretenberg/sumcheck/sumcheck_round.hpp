@@ -2,6 +2,8 @@
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/polynomials/gate_separator.hpp"
+#include "barretenberg/polynomials/span_kernels.hpp"
+#include "barretenberg/polynomials/univariate_block.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include "barretenberg/relations/relation_types.hpp"
 #include "barretenberg/relations/utils.hpp"
@@ -24,6 +26,10 @@ polynomials to \f$ T^i(X_i)\f$
  - \ref bb::SumcheckProverRound::extend_and_batch_univariates "Extend and batch the subrelation contibutions"
  multiplying by the constants \f$c_i\f$ and the evaluations of \f$ ( (1−X_i) + X_i\cdot \beta_i ) \f$.
 
+ The first two steps are done by one of two engines, see \ref bb::SumcheckProverRound::Engine "Engine": the default
+ row-major engine goes edge by edge as described above, the column-major engine evaluates the relations on blocks of
+ edges (\ref bb::SumcheckProverRound::accumulate_edge_blocks "accumulate edge blocks").
+
  Note: This class uses recursive function calls with template parameters. This is a common trick that is used to force
  the compiler to unroll loops. The idea is that a function that is only called once will always be inlined, and since
  template functions always create different functions, this is guaranteed.
@@ -40,6 +46,7 @@ template <typename Flavor> class SumcheckProverRound {
   public:
     using FF = typename Flavor::FF;
     using ExtendedEdges = typename Flavor::ExtendedEdges;
+    using PartiallyEvaluatedMultivariates = typename Flavor::PartiallyEvaluatedMultivariates;
     /**
      * @brief In Round \f$i = 0,\ldots, d-1\f$, equals \f$2^{d-i}\f$.
      */
@@ -62,6 +69,38 @@ template <typename Flavor> class SumcheckProverRound {
     static constexpr size_t BATCHED_RELATION_PARTIAL_LENGTH = Flavor::BATCHED_RELATION_PARTIAL_LENGTH;
     using SumcheckRoundUnivariate = bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH>;
     SumcheckTupleOfTuplesOfUnivariates univariate_accumulators;
+
+    /**
+     * @brief How the contributions of the edges to the round univariate are computed
+     * @details ROW_MAJOR extends every entity of one edge into ExtendedEdges and then runs all relations on it, edge by
+     * edge. COLUMN_MAJOR runs each relation on EDGE_BLOCK_SIZE edges at a time, see accumulate_edge_blocks; flavors
+     * with ZK always use ROW_MAJOR. Both compute the same round univariate.
+     */
+    enum class Engine { ROW_MAJOR, COLUMN_MAJOR };
+    Engine engine = Engine::ROW_MAJOR;
+    // The number of edges the column-major engine evaluates together; 8 and 32 were both slower for Ultra
+    static constexpr size_t EDGE_BLOCK_SIZE = 16;
+    // The number of rows compute_univariate_and_partially_evaluate folds at a time, a block of the column-major engine
+    static constexpr size_t FUSED_PARTIAL_EVALUATION_ROWS = 2 * EDGE_BLOCK_SIZE;
+
+    /**
+     * @brief Whether each entity only takes the values 0 and 1 in the current round
+     * @details In the first round most selectors and the Lagrange polynomials are boolean, and the extension of a
+     * boolean edge is one of the four BOOLEAN_EDGE_EXTENSIONS, which extend_edges copies rather than computing it.
+     * Set by compute_univariate: scanned in the first round, false in later rounds where the polynomials have been
+     * folded with a challenge.
+     */
+    std::array<bool, Flavor::NUM_ALL_ENTITIES> boolean_entities{};
+    // The extensions of the edges (0, 0), (0, 1), (1, 0) and (1, 1)
+    static inline const std::array<bb::Univariate<FF, MAX_PARTIAL_RELATION_LENGTH>, 4> BOOLEAN_EDGE_EXTENSIONS = [] {
+        std::array<bb::Univariate<FF, MAX_PARTIAL_RELATION_LENGTH>, 4> extensions;
+        for (size_t idx = 0; idx < 4; ++idx) {
+            bb::Univariate<FF, 2> edge({ FF(idx >> 1), FF(idx & 1) });
+            extensions[idx] = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
+        }
+        return extensions;
+    }();
+
     // Prover constructor
     SumcheckProverRound(size_t initial_round_size)
         : round_size(initial_round_size)
@@ -71,6 +110,23 @@ template <typename Flavor> class SumcheckProverRound {
         Utils::zero_univariates(univariate_accumulators);
     }
 
+    /**
+     * @brief Set boolean_entities to whether each polynomial only takes the values 0 and 1
+     * @details A scan stops at the first value that is not boolean, which for witnesses is almost always one of the
+     * first few, so this reads little more than the boolean polynomials themselves.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    void find_boolean_entities(ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials)
+    {
+        auto all_polynomials = polynomials.get_all();
+        parallel_for(boolean_entities.size(), [&](size_t idx) {
+            const auto& polynomial = all_polynomials[idx];
+            boolean_entities[idx] = std::all_of(polynomial.data(),
+                                                polynomial.data() + polynomial.size(),
+                                                [](const FF& value) { return value.is_zero() || value == FF::one(); });
+        });
+    }
+
     /**
      * @brief  To compute the round univariate in Round \f$i\f$, the prover first computes the values of Honk
      polynomials \f$ P_1,\ldots, P_N \f$ at the points of the form \f$ (u_0,\ldots, u_{i-1}, k, \vec \ell)\f$ for \f$
@@ -107,7 +163,14 @@ template <typename Flavor> class SumcheckProverRound {
     {
 
         if constexpr (!Flavor::HasZK) {
-            for (auto [extended_edge, multivariate] : zip_view(extended_edges.get_all(), multivariates.get_all())) {
+            for (auto [extended_edge, multivariate, is_boolean] :
+                 zip_view(extended_edges.get_all(), multivariates.get_all(), boolean_entities)) {
+                if (is_boolean) {
+                    const size_t extension_idx = 2 * static_cast<size_t>(!multivariate[edge_idx].is_zero()) +
+                                                 static_cast<size_t>(!multivariate[edge_idx + 1].is_zero());
+                    extended_edge = BOOLEAN_EDGE_EXTENSIONS[extension_idx];
+                    continue;
+                }
                 bb::Univariate<FF, 2> edge({ multivariate[edge_idx], multivariate[edge_idx + 1] });
                 extended_edge = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
             }
@@ -164,64 +227,62 @@ template <typename Flavor> class SumcheckProverRound {
         ZoneScopedN("compute_univariate");
         BB_OP_COUNT_TIME();
 
-        // Determine number of threads for multithreading.
-        // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
-        // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
-        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
-        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
-        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
-
-        // Construct univariate accumulator containers; one per thread
-        std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
-        for (auto& accum : thread_univariate_accumulators) {
-            Utils::zero_univariates(accum);
+        if constexpr (!Flavor::HasZK) {
+            if (round_idx == 0) {
+                find_boolean_entities(polynomials);
+            } else {
+                boolean_entities.fill(false);
+            }
         }
+        auto no_preparation = [](size_t, size_t) {};
+        return compute_univariate_internal(
+            round_idx, polynomials, no_preparation, relation_parameters, gate_sparators, alpha, zk_sumcheck_data);
+    }
 
-        // Construct extended edge containers; one per thread
-        std::vector<ExtendedEdges> extended_edges;
-        extended_edges.resize(num_threads);
-
-        // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
-        parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
+    /**
+     * @brief Partially evaluate the table of the previous round at its challenge into polynomials, and compute the
+     * round univariate from it, in a single pass over the table of the previous round
+     *
+     * @details This computes the same as \ref bb::SumcheckProver::partially_evaluate "partially_evaluate" followed by
+     * \ref compute_univariate "compute_univariate" on its result, but the rows of polynomials are computed
+     * FUSED_PARTIAL_EVALUATION_ROWS at a time just before the relations read them, so they are read from the cache
+     * rather than from memory. polynomials must not alias previous_polynomials, as the rows one thread writes would
+     * overwrite rows another thread has yet to read.
+     *
+     * @param previous_polynomials The table of the previous round, of at least 2 * round_size rows
+     * @param previous_challenge The challenge of the previous round
+     * @param polynomials Receives the round_size rows of the table of this round
+     */
+    template <typename PreviousPolynomials>
+    SumcheckRoundUnivariate compute_univariate_and_partially_evaluate(
+        const size_t round_idx,
+        PreviousPolynomials& previous_polynomials,
+        const FF& previous_challenge,
+        PartiallyEvaluatedMultivariates& polynomials,
+        const bb::RelationParameters<FF>& relation_parameters,
+        const bb::GateSeparatorPolynomial<FF>& gate_sparators,
+        const RelationSeparator alpha,
+        std::optional<ZKSumcheckData<Flavor>> zk_sumcheck_data = std::nullopt) // only submitted when Flavor HasZK
+    {
+        ZoneScopedN("compute_univariate_and_partially_evaluate");
+        BB_OP_COUNT_TIME();
 
-            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                if constexpr (!Flavor::HasZK) {
-                    extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
-                } else {
-                    extend_edges(extended_edges[thread_idx], polynomials, edge_idx, zk_sumcheck_data);
-                }
-                // Compute the \f$ \ell \f$-th edge's univariate contribution,
-                // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for \f$
-                // \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$ (\ell_{i+1},\ldots,
-                // \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot
-                // \beta_{d-1}^{\ell_{d-1}}\f$.
-                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                extended_edges[thread_idx],
-                                                relation_parameters,
-                                                gate_sparators[(edge_idx >> 1) * gate_sparators.periodicity]);
+        boolean_entities.fill(false);
+        auto partially_evaluate_rows = [&](size_t start, size_t end) {
+            for (auto [polynomial, previous_polynomial] :
+                 zip_view(polynomials.get_all(), previous_polynomials.get_all())) {
+                span_kernels::fold<FF>(std::span<FF>(polynomial.data() + start, end - start),
+                                       std::span<const FF>(previous_polynomial.data() + 2 * start, 2 * (end - start)),
+                                       previous_challenge);
             }
-        });
-
-        // Accumulate the per-thread univariate accumulators into a single set of accumulators
-        for (auto& accumulators : thread_univariate_accumulators) {
-            Utils::add_nested_tuples(univariate_accumulators, accumulators);
-        }
-        // For ZK Flavors: The evaluations of the round univariates are masked by the evaluations of Libra univariates
-        if constexpr (Flavor::HasZK) {
-            auto libra_round_univariate = compute_libra_round_univariate(zk_sumcheck_data.value(), round_idx);
-            // Batch the univariate contributions from each sub-relation to obtain the round univariate
-            auto round_univariate =
-                batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_sparators);
-            // Mask the round univariate
-            return round_univariate + libra_round_univariate;
-        }
-        // Batch the univariate contributions from each sub-relation to obtain the round univariate
-        else {
-            return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_sparators);
-        }
+        };
+        return compute_univariate_internal(round_idx,
+                                           polynomials,
+                                           partially_evaluate_rows,
+                                           relation_parameters,
+                                           gate_sparators,
+                                           alpha,
+                                           zk_sumcheck_data);
     }
 
     /**
@@ -328,6 +389,100 @@ template <typename Flavor> class SumcheckProverRound {
     }
 
   private:
+    /**
+     * @brief The computation of the round univariate shared by compute_univariate and
+     * compute_univariate_and_partially_evaluate
+     * @details prepare_rows(start, end) is called before the rows in [start, end) of polynomials are read, in blocks
+     * of at most FUSED_PARTIAL_EVALUATION_ROWS rows.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates, typename PrepareRows>
+    SumcheckRoundUnivariate compute_univariate_internal(const size_t round_idx,
+                                                        ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
+                                                        const PrepareRows& prepare_rows,
+                                                        const bb::RelationParameters<FF>& relation_parameters,
+                                                        const bb::GateSeparatorPolynomial<FF>& gate_sparators,
+                                                        const RelationSeparator alpha,
+                                                        std::optional<ZKSumcheckData<Flavor>> zk_sumcheck_data)
+    {
+        // Determine number of threads for multithreading.
+        // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
+        // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
+        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
+        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
+        size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
+        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
+
+        // Construct univariate accumulator containers; one per thread
+        std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
+        for (auto& accum : thread_univariate_accumulators) {
+            Utils::zero_univariates(accum);
+        }
+
+        // The column-major engine needs whole blocks of edges in each thread
+        const bool use_column_major =
+            !Flavor::HasZK && engine == Engine::COLUMN_MAJOR && iterations_per_thread % (2 * EDGE_BLOCK_SIZE) == 0;
+
+        // Construct extended edge containers; one per thread
+        std::vector<ExtendedEdges> extended_edges;
+        extended_edges.resize(use_column_major ? 0 : num_threads);
+
+        // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            size_t start = thread_idx * iterations_per_thread;
+            size_t end = (thread_idx + 1) * iterations_per_thread;
+
+            if constexpr (!Flavor::HasZK) {
+                if (use_column_major) {
+                    accumulate_edge_blocks(thread_univariate_accumulators[thread_idx],
+                                           polynomials,
+                                           prepare_rows,
+                                           start,
+                                           end,
+                                           relation_parameters,
+                                           gate_sparators);
+                    return;
+                }
+            }
+            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
+                if (edge_idx % FUSED_PARTIAL_EVALUATION_ROWS == 0) {
+                    prepare_rows(edge_idx, std::min(edge_idx + FUSED_PARTIAL_EVALUATION_ROWS, end));
+                }
+                if constexpr (!Flavor::HasZK) {
+                    extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
+                } else {
+                    extend_edges(extended_edges[thread_idx], polynomials, edge_idx, zk_sumcheck_data);
+                }
+                // Compute the \f$ \ell \f$-th edge's univariate contribution,
+                // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for \f$
+                // \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$ (\ell_{i+1},\ldots,
+                // \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot
+                // \beta_{d-1}^{\ell_{d-1}}\f$.
+                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                extended_edges[thread_idx],
+                                                relation_parameters,
+                                                gate_sparators[(edge_idx >> 1) * gate_sparators.periodicity]);
+            }
+        });
+
+        // Accumulate the per-thread univariate accumulators into a single set of accumulators
+        for (auto& accumulators : thread_univariate_accumulators) {
+            Utils::add_nested_tuples(univariate_accumulators, accumulators);
+        }
+        // For ZK Flavors: The evaluations of the round univariates are masked by the evaluations of Libra univariates
+        if constexpr (Flavor::HasZK) {
+            auto libra_round_univariate = compute_libra_round_univariate(zk_sumcheck_data.value(), round_idx);
+            // Batch the univariate contributions from each sub-relation to obtain the round univariate
+            auto round_univariate =
+                batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_sparators);
+            // Mask the round univariate
+            return round_univariate + libra_round_univariate;
+        }
+        // Batch the univariate contributions from each sub-relation to obtain the round univariate
+        else {
+            return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_sparators);
+        }
+    }
+
     /**
      * @brief In Round \f$ i \f$, for a given point \f$ \vec \ell \in \{0,1\}^{d-1 - i}\f$, calculate the contribution
      * of each sub-relation to \f$ T^i(X_i) \f$.
@@ -380,6 +535,113 @@ template <typename Flavor> class SumcheckProverRound {
                 univariate_accumulators, extended_edges, relation_parameters, scaling_factor);
         }
     }
+
+    /**
+     * @brief The column-major engine: add the contributions of the edges in [start, end) to the univariate
+     * accumulators, EDGE_BLOCK_SIZE edges at a time
+     *
+     * @details For each block of edges, every entity is an EdgeBlock pointing at the values of its polynomial, and
+     * every relation is evaluated on UnivariateBlocks that hold one univariate per edge. Each arithmetic operation of
+     * a relation is then a single pass over an array of field elements rather than one operation per edge, and only
+     * the entities a relation reads are extended. The working set is therefore that of one relation, rather than the
+     * extended edges of all entities, which is what thrashes the cache of the row-major engine for flavors with
+     * hundreds of entities such as the AVM.
+     *
+     * The gate separator factor differs from edge to edge, so the relations are given a scaling factor of one and the
+     * factors are applied when the block of a linearly independent subrelation is added to its accumulator.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates, typename PrepareRows>
+    void accumulate_edge_blocks(SumcheckTupleOfTuplesOfUnivariates& univariate_accumulators,
+                                ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
+                                const PrepareRows& prepare_rows,
+                                const size_t start,
+                                const size_t end,
+                                const bb::RelationParameters<FF>& relation_parameters,
+                                const bb::GateSeparatorPolynomial<FF>& gate_sparators)
+    {
+        using EdgeBlocks =
+            typename Flavor::template AllEntities<EdgeBlock<FF, MAX_PARTIAL_RELATION_LENGTH, EDGE_BLOCK_SIZE>>;
+        using SumcheckTupleOfTuplesOfUnivariateBlocks =
+            decltype(create_sumcheck_tuple_of_tuples_of_univariate_blocks<Relations, EDGE_BLOCK_SIZE>());
+        constexpr size_t VALUES_PER_BLOCK = 2 * EDGE_BLOCK_SIZE;
+
+        EdgeBlocks edge_blocks;
+        // Blocks of all subrelations are too large for the stack
+        auto block_accumulators = std::make_unique<SumcheckTupleOfTuplesOfUnivariateBlocks>();
+        std::array<FF, EDGE_BLOCK_SIZE> gate_separator_values;
+
+        for (size_t block_start = start; block_start < end; block_start += VALUES_PER_BLOCK) {
+            prepare_rows(block_start, block_start + VALUES_PER_BLOCK);
+            for (auto [edge_block, polynomial] : zip_view(edge_blocks.get_all(), polynomials.get_all())) {
+                ASSERT(block_start + VALUES_PER_BLOCK <= polynomial.size());
+                edge_block.values = polynomial.data() + block_start;
+            }
+            for (size_t e = 0; e < EDGE_BLOCK_SIZE; ++e) {
+                gate_separator_values[e] = gate_sparators[((block_start >> 1) + e) * gate_sparators.periodicity];
+            }
+            accumulate_relation_blocks(
+                univariate_accumulators, *block_accumulators, edge_blocks, relation_parameters, gate_separator_values);
+        }
+    }
+
+    /**
+     * @brief Evaluate each relation on a block of edges and add its contribution to the univariate accumulators
+     */
+    template <size_t relation_idx = 0>
+    void accumulate_relation_blocks(SumcheckTupleOfTuplesOfUnivariates& univariate_accumulators,
+                                    auto& block_accumulators,
+                                    const auto& edge_blocks,
+                                    const bb::RelationParameters<FF>& relation_parameters,
+                                    std::span<const FF, EDGE_BLOCK_SIZE> gate_separator_values)
+    {
+        using Relation = std::tuple_element_t<relation_idx, Relations>;
+        bool skip = false;
+        if constexpr (isSkippable<Relation, decltype(edge_blocks)>) {
+            // The relation is skipped only if it is inactive on all edges of the block
+            skip = Relation::skip(edge_blocks);
+        }
+        if (!skip) {
+            auto& relation_blocks = std::get<relation_idx>(block_accumulators);
+            std::apply([](auto&... blocks) { (blocks.evaluations.fill(FF(0)), ...); }, relation_blocks);
+            Relation::accumulate(relation_blocks, edge_blocks, relation_parameters, FF(1));
+            add_relation_blocks<Relation>(
+                std::get<relation_idx>(univariate_accumulators), relation_blocks, gate_separator_values);
+        }
+        // Repeat for the next relation.
+        if constexpr (relation_idx + 1 < NUM_RELATIONS) {
+            accumulate_relation_blocks<relation_idx + 1>(
+                univariate_accumulators, block_accumulators, edge_blocks, relation_parameters, gate_separator_values);
+        }
+    }
+
+    /**
+     * @brief Add the per-edge univariates of each subrelation of a relation to its accumulator, scaled by the gate
+     * separator factors of the edges if the subrelation is linearly independent
+     */
+    template <typename Relation, typename TupleOfUnivariates, typename TupleOfUnivariateBlocks>
+    static void add_relation_blocks(TupleOfUnivariates& univariates,
+                                    const TupleOfUnivariateBlocks& blocks,
+                                    std::span<const FF, EDGE_BLOCK_SIZE> gate_separator_values)
+    {
+        [&]<size_t... subrelation_idx>(std::index_sequence<subrelation_idx...>) {
+            (
+                [&]() {
+                    auto& univariate = std::get<subrelation_idx>(univariates);
+                    const auto& block = std::get<subrelation_idx>(blocks);
+                    for (size_t k = 0; k < univariate.evaluations.size(); ++k) {
+                        if constexpr (subrelation_is_linearly_independent<Relation, subrelation_idx>()) {
+                            univariate.evaluations[k] +=
+                                span_kernels::inner_product<FF>(block.values_at(k), gate_separator_values);
+                        } else {
+                            for (const FF& value : block.values_at(k)) {
+                                univariate.evaluations[k] += value;
+                            }
+                        }
+                    }
+                }(),
+                ...);
+        }(std::make_index_sequence<std::tuple_size_v<TupleOfUnivariates>>());
+    }
 };
 
 /*!\brief Implementation of the Sumcheck Verifier Round
@@ -1,5 +1,6 @@
 #include "sumcheck_round.hpp"
 #include "barretenberg/relations/utils.hpp"
+#include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 
 #include <gtest/gtest.h>
@@ -131,3 +132,94 @@ TEST(SumcheckRound, AddTuplesOfTuplesOfUnivariates)
     EXPECT_EQ(std::get<0>(std::get<1>(tuple_of_tuples_1)), expected_sum_2);
     EXPECT_EQ(std::get<1>(std::get<1>(tuple_of_tuples_1)), expected_sum_3);
 }
+
+namespace {
+auto& rng = numeric::get_debug_randomness();
+
+template <typename Flavor> class SumcheckRoundEngineTests : public ::testing::Test {};
+
+using FlavorTypes = testing::Types<UltraFlavor, MegaFlavor>;
+TYPED_TEST_SUITE(SumcheckRoundEngineTests, FlavorTypes);
+} // namespace
+
+/**
+ * @brief Check that the column-major engine computes the same round univariate as the row-major engine
+ * @details Some of the polynomials are zero, so that relations are skipped on some blocks of edges.
+ */
+TYPED_TEST(SumcheckRoundEngineTests, ColumnMajorMatchesRowMajor)
+{
+    using Flavor = TypeParam;
+    using FF = typename Flavor::FF;
+    using Round = SumcheckProverRound<Flavor>;
+
+    const size_t log_n = 8;
+    const size_t n = 1 << log_n;
+    typename Flavor::ProverPolynomials polynomials;
+    size_t idx = 0;
+    for (auto& polynomial : polynomials.get_all()) {
+        polynomial = idx++ % 7 == 3 ? Polynomial<FF>(n) : Polynomial<FF>::random(n);
+    }
+    RelationParameters<FF> relation_parameters = RelationParameters<FF>::get_random();
+    std::vector<FF> betas(log_n);
+    for (auto& beta : betas) {
+        beta = FF::random_element();
+    }
+    GateSeparatorPolynomial<FF> gate_separators(betas, log_n);
+    typename Flavor::RelationSeparator alpha;
+    for (auto& alpha_i : alpha) {
+        alpha_i = FF::random_element();
+    }
+
+    Round row_major_round(n);
+    Round column_major_round(n);
+    column_major_round.engine = Round::Engine::COLUMN_MAJOR;
+    auto expected = row_major_round.compute_univariate(0, polynomials, relation_parameters, gate_separators, alpha);
+    auto result = column_major_round.compute_univariate(0, polynomials, relation_parameters, gate_separators, alpha);
+    EXPECT_EQ(result, expected);
+}
+
+/**
+ * @brief Check that the first round detects the boolean polynomials, and that extending their edges from the table of
+ * boolean extensions gives the same round univariate as extending them generically
+ */
+TYPED_TEST(SumcheckRoundEngineTests, BooleanEntities)
+{
+    using Flavor = TypeParam;
+    using FF = typename Flavor::FF;
+    using Round = SumcheckProverRound<Flavor>;
+
+    const size_t log_n = 8;
+    const size_t n = 1 << log_n;
+    typename Flavor::ProverPolynomials polynomials;
+    std::array<bool, Flavor::NUM_ALL_ENTITIES> expected_boolean_entities;
+    size_t idx = 0;
+    for (auto& polynomial : polynomials.get_all()) {
+        const bool is_boolean = idx % 3 == 0;
+        polynomial = Polynomial<FF>::random(n);
+        if (is_boolean) {
+            for (size_t i = 0; i < n; ++i) {
+                polynomial[i] = FF(rng.get_random_uint8() & 1);
+            }
+        }
+        expected_boolean_entities[idx++] = is_boolean;
+    }
+    RelationParameters<FF> relation_parameters = RelationParameters<FF>::get_random();
+    std::vector<FF> betas(log_n);
+    for (auto& beta : betas) {
+        beta = FF::random_element();
+    }
+    GateSeparatorPolynomial<FF> gate_separators(betas, log_n);
+    typename Flavor::RelationSeparator alpha;
+    for (auto& alpha_i : alpha) {
+        alpha_i = FF::random_element();
+    }
+
+    Round first_round(n);
+    auto result = first_round.compute_univariate(0, polynomials, relation_parameters, gate_separators, alpha);
+    EXPECT_EQ(first_round.boolean_entities, expected_boolean_entities);
+
+    // Later rounds never look for boolean polynomials
+    Round later_round(n);
+    auto expected = later_round.compute_univariate(1, polynomials, relation_parameters, gate_separators, alpha);
+    EXPECT_EQ(result, expected);
+}
@@ -30,6 +30,12 @@ template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_relation_ch
     using Sumcheck = SumcheckProver<Flavor>;
     auto instance_size = accumulator->proving_key.circuit_size;
     auto sumcheck = Sumcheck(instance_size, transcript);
+    if (memory_budget) {
+        memory_budget->enter(MemoryBudget::Phase::SUMCHECK);
+        sumcheck.on_prover_polynomials_consumed = [this]() {
+            memory_budget->enter(MemoryBudget::Phase::SUMCHECK_PARTIALLY_EVALUATED);
+        };
+    }
     {
         ZoneScopedN("sumcheck.prove");
         sumcheck_output = sumcheck.prove(accumulator);
@@ -45,6 +51,9 @@ template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_relation_ch
 template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_pcs_rounds()
 {
     using ZeroMorph = ZeroMorphProver_<Curve>;
+    if (memory_budget) {
+        memory_budget->enter(MemoryBudget::Phase::PCS);
+    }
     auto prover_opening_claim = ZeroMorph::prove(accumulator->proving_key.circuit_size,
                                                  accumulator->proving_key.polynomials.get_unshifted(),
                                                  accumulator->proving_key.polynomials.get_to_be_shifted(),
@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/commitment_schemes/zeromorph/zeromorph.hpp"
+#include "barretenberg/honk/proof_system/prover_memory_budget.hpp"
 #include "barretenberg/honk/proof_system/types/proof.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
@@ -23,6 +24,7 @@ template <IsUltraFlavor Flavor> class DeciderProver_ {
     using Instance = ProverInstance_<Flavor>;
     using Transcript = typename Flavor::Transcript;
     using RelationSeparator = typename Flavor::RelationSeparator;
+    using MemoryBudget = ProverMemoryBudget<Flavor>;
 
   public:
     explicit DeciderProver_(const std::shared_ptr<Instance>&,
@@ -48,6 +50,9 @@ template <IsUltraFlavor Flavor> class DeciderProver_ {
 
     std::shared_ptr<CommitmentKey> commitment_key;
 
+    // If set, pages the prover polynomials in and out of memory around the sumcheck and PCS rounds
+    std::shared_ptr<MemoryBudget> memory_budget;
+
   private:
     HonkProof proof;
 };
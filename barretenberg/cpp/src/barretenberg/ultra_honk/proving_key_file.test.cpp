@@ -0,0 +1,98 @@
+#include "barretenberg/honk/proof_system/proving_key_file.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
+#include "barretenberg/sumcheck/instance/prover_instance.hpp"
+
+#include <gtest/gtest.h>
+#include <limits>
+
+using namespace bb;
+
+class ProvingKeyFileTests : public ::testing::Test {
+  protected:
+    using Flavor = UltraFlavor;
+    using ProverInstance = ProverInstance_<Flavor>;
+    using KeyFile = ProvingKeyFile<Flavor>;
+
+    static void SetUpTestSuite() { srs::init_crs_factory("../srs_db/ignition"); }
+
+    void SetUp() override
+    {
+        path = std::filesystem::temp_directory_path() /
+               ("proving_key_file_test_" + std::to_string(getpid()) + "_" +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".pk");
+        UltraCircuitBuilder builder;
+        MockCircuits::add_arithmetic_gates_with_public_inputs(builder, 10);
+        MockCircuits::add_lookup_gates(builder);
+        instance = std::make_shared<ProverInstance>(builder);
+        KeyFile::write(path, instance->proving_key);
+    }
+
+    void TearDown() override { std::filesystem::remove(path); }
+
+    // Overwrite a field of the header, which is a sequence of uint64_t: magic, version, circuit size, number of public
+    // inputs, then the offset and size of each block
+    void write_header_field(size_t field_index, uint64_t value) const
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(field_index * sizeof(uint64_t)));
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    static constexpr size_t CIRCUIT_SIZE_FIELD = 2;
+    static constexpr size_t NUM_PUBLIC_INPUTS_FIELD = 3;
+    static constexpr size_t FIRST_BLOCK_OFFSET_FIELD = 4;
+    static constexpr size_t FIRST_BLOCK_SIZE_FIELD = 5;
+
+    std::filesystem::path path;
+    std::shared_ptr<ProverInstance> instance;
+};
+
+TEST_F(ProvingKeyFileTests, RoundTrip)
+{
+    auto proving_key = KeyFile::read(path);
+    ASSERT_TRUE(proving_key.has_value());
+    EXPECT_EQ(proving_key->circuit_size, instance->proving_key.circuit_size);
+    EXPECT_EQ(proving_key->num_public_inputs, instance->proving_key.num_public_inputs);
+    for (auto [read, written] :
+         zip_view(proving_key->polynomials.get_precomputed(), instance->proving_key.polynomials.get_precomputed())) {
+        EXPECT_EQ(read, written);
+    }
+    for (auto [read, written] :
+         zip_view(proving_key->polynomials.get_shifted(), instance->proving_key.polynomials.get_shifted())) {
+        EXPECT_EQ(read.size(), written.size());
+    }
+    for (auto& witness : proving_key->polynomials.get_witness()) {
+        EXPECT_EQ(witness.size(), instance->proving_key.circuit_size);
+    }
+}
+
+TEST_F(ProvingKeyFileTests, MissingOrTruncatedFile)
+{
+    EXPECT_FALSE(KeyFile::read(path.string() + ".missing").has_value());
+
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) / 2);
+    EXPECT_FALSE(KeyFile::read(path).has_value());
+    std::filesystem::resize_file(path, 8);
+    EXPECT_FALSE(KeyFile::read(path).has_value());
+}
+
+TEST_F(ProvingKeyFileTests, RejectMalformedHeader)
+{
+    const uint64_t circuit_size = instance->proving_key.circuit_size;
+    const auto expect_rejected = [&](size_t field_index, uint64_t value) {
+        write_header_field(field_index, value);
+        EXPECT_FALSE(KeyFile::read(path).has_value());
+        KeyFile::write(path, instance->proving_key);
+        ASSERT_TRUE(KeyFile::read(path).has_value());
+    };
+
+    expect_rejected(CIRCUIT_SIZE_FIELD, 0);
+    expect_rejected(CIRCUIT_SIZE_FIELD, circuit_size + 1);
+    expect_rejected(NUM_PUBLIC_INPUTS_FIELD, circuit_size + 1);
+    // A block larger than the circuit, even if the file were large enough to hold it
+    expect_rejected(FIRST_BLOCK_SIZE_FIELD, circuit_size + 1);
+    expect_rejected(FIRST_BLOCK_SIZE_FIELD, std::numeric_limits<uint64_t>::max());
+    // Offsets that are misaligned, or whose block would wrap around the address space
+    expect_rejected(FIRST_BLOCK_OFFSET_FIELD, KeyFile::BLOCK_ALIGNMENT + 1);
+    expect_rejected(FIRST_BLOCK_OFFSET_FIELD, std::numeric_limits<uint64_t>::max() - KeyFile::BLOCK_ALIGNMENT + 1);
+}
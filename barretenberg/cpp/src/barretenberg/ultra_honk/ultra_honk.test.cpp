@@ -106,6 +106,40 @@ TEST_F(UltraHonkTests, StructuredTrace)
     EXPECT_TRUE(verifier.verify_proof(proof));
 }
 
+/**
+ * @brief The proof does not depend on how many of the prover polynomials are spilled to disk to meet a memory budget
+ */
+TEST_F(UltraHonkTests, MemoryBudget)
+{
+    auto builder = UltraCircuitBuilder();
+    MockCircuits::add_arithmetic_gates_with_public_inputs(builder, 1 << 10);
+    MockCircuits::add_lookup_gates(builder);
+
+    // Constructing an instance finalizes its circuit, so every prover gets a copy
+    auto builder_copy = builder;
+    auto instance = std::make_shared<ProverInstance>(builder_copy);
+    auto verification_key = std::make_shared<VerificationKey>(instance->proving_key);
+    const size_t num_unshifted = instance->proving_key.polynomials.get_unshifted().size();
+    const size_t polynomial_bytes = (instance->proving_key.circuit_size + 1) * sizeof(bb::fr);
+    UltraProver prover(instance);
+    auto expected_proof = prover.construct_proof();
+
+    // Spill half of the polynomials, then all of them
+    for (const size_t budget_bytes : { num_unshifted / 2 * polynomial_bytes, size_t{ 0 } }) {
+        builder_copy = builder;
+        auto budgeted_instance = std::make_shared<ProverInstance>(builder_copy);
+        UltraProver budgeted_prover(budgeted_instance);
+        budgeted_prover.memory_budget = std::make_shared<ProverMemoryBudget<UltraFlavor>>(budget_bytes);
+        auto proof = budgeted_prover.construct_proof();
+
+        const size_t expected_num_spilled = budget_bytes == 0 ? num_unshifted : num_unshifted - num_unshifted / 2;
+        EXPECT_EQ(budgeted_prover.memory_budget->num_spilled(), expected_num_spilled);
+        EXPECT_EQ(proof, expected_proof);
+        UltraVerifier verifier(verification_key);
+        EXPECT_TRUE(verifier.verify_proof(proof));
+    }
+}
+
 /**
  * @brief Test simple circuit with public inputs
  *
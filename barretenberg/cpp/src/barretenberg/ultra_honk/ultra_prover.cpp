@@ -48,12 +48,17 @@ template <IsUltraFlavor Flavor> void UltraProver_<Flavor>::generate_gate_challen
 
 template <IsUltraFlavor Flavor> HonkProof UltraProver_<Flavor>::construct_proof()
 {
+    if (memory_budget) {
+        memory_budget->spill(instance->proving_key.polynomials);
+        memory_budget->enter(ProverMemoryBudget<Flavor>::Phase::OINK);
+    }
     OinkProver<Flavor> oink_prover(instance, transcript);
     oink_prover.prove();
 
     generate_gate_challenges();
 
     DeciderProver_<Flavor> decider_prover(instance, transcript);
+    decider_prover.memory_budget = memory_budget;
     return decider_prover.construct_proof();
 }
 
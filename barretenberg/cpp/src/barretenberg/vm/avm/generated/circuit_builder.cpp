@@ -13,17 +13,17 @@
 
 namespace bb {
 
-AvmCircuitBuilder::ProverPolynomials AvmCircuitBuilder::compute_polynomials() const
-{
-    const auto num_rows = get_circuit_subgroup_size();
-    ProverPolynomials polys;
-
-    // Allocate mem for each column
-    for (auto& poly : polys.get_all()) {
-        poly = Polynomial(num_rows);
-    }
+namespace {
 
-    for (size_t i = 0; i < rows.size(); i++) {
+/**
+ * @brief Copy rows [start, end) of the row-major trace into the corresponding column polynomials
+ * @details Works for any container holding one polynomial member per column, i.e. both the prover polynomials and the
+ * proving key.
+ */
+template <typename Polynomials, typename Row>
+void transpose_rows(Polynomials& polys, const std::vector<Row>& rows, size_t start, size_t end)
+{
+    for (size_t i = start; i < end; i++) {
         polys.byte_lookup_sel_bin[i] = rows[i].byte_lookup_sel_bin;
         polys.byte_lookup_table_byte_lengths[i] = rows[i].byte_lookup_table_byte_lengths;
         polys.byte_lookup_table_in_tags[i] = rows[i].byte_lookup_table_in_tags;
@@ -670,6 +670,20 @@ AvmCircuitBuilder::ProverPolynomials AvmCircuitBuilder::compute_polynomials() co
         polys.incl_main_tag_err_counts[i] = rows[i].incl_main_tag_err_counts;
         polys.incl_mem_tag_err_counts[i] = rows[i].incl_mem_tag_err_counts;
     }
+}
+
+} // namespace
+
+AvmCircuitBuilder::ProverPolynomials AvmCircuitBuilder::compute_polynomials() const
+{
+    const auto num_rows = get_circuit_subgroup_size();
+    ProverPolynomials polys;
+
+    // Allocate mem for each column (the shifted columns are views into these)
+    auto unshifted = polys.get_unshifted();
+    parallel_for(unshifted.size(), [&](size_t i) { unshifted[i] = Polynomial(num_rows); });
+
+    parallel_for_range(rows.size(), [&](size_t start, size_t end) { transpose_rows(polys, rows, start, end); });
 
     for (auto [shifted, to_be_shifted] : zip_view(polys.get_shifted(), polys.get_to_be_shifted())) {
         shifted = to_be_shifted.shifted();
@@ -678,6 +692,13 @@ AvmCircuitBuilder::ProverPolynomials AvmCircuitBuilder::compute_polynomials() co
     return polys;
 }
 
+void AvmCircuitBuilder::populate_proving_key(Flavor::ProvingKey& proving_key) const
+{
+    ASSERT(proving_key.circuit_size >= rows.size());
+    parallel_for_range(rows.size(),
+                       [&](size_t start, size_t end) { transpose_rows(proving_key, rows, start, end); });
+}
+
 bool AvmCircuitBuilder::check_circuit() const
 {
     const FF gamma = FF::random_element();
@@ -25,6 +25,8 @@ class AvmCircuitBuilder {
     void set_trace(std::vector<Row>&& trace) { rows = std::move(trace); }
 
     ProverPolynomials compute_polynomials() const;
+    // Transpose the trace directly into the (already allocated) polynomials of a proving key
+    void populate_proving_key(Flavor::ProvingKey& proving_key) const;
 
     bool check_circuit() const;
 
@@ -15,12 +15,9 @@ void AvmComposer::compute_witness(CircuitConstructor& circuit)
         return;
     }
 
-    auto polynomials = circuit.compute_polynomials();
-
-    for (auto [key_poly, prover_poly] : zip_view(proving_key->get_all(), polynomials.get_unshifted())) {
-        ASSERT(flavor_get_label(*proving_key, key_poly) == flavor_get_label(polynomials, prover_poly));
-        key_poly = prover_poly;
-    }
+    // Write the trace straight into the proving key rather than into a separate set of prover polynomials that would
+    // then have to be copied over, which would hold three copies of the trace in memory at once
+    circuit.populate_proving_key(*proving_key);
 
     computed_witness = true;
 }
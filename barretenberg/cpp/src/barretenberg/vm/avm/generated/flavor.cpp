@@ -1,6 +1,8 @@
 // AUTOGENERATED FILE
 #include "barretenberg/vm/avm/generated/flavor.hpp"
 
+#include "barretenberg/common/thread.hpp"
+
 namespace bb {
 
 AvmFlavor::AllConstRefValues::AllConstRefValues(
@@ -2274,13 +2276,11 @@ AvmFlavor::ProvingKey::ProvingKey(const size_t circuit_size, const size_t num_pu
     this->num_public_inputs = num_public_inputs;
 
     // Allocate memory for precomputed polynomials
-    for (auto& poly : PrecomputedEntities<Polynomial>::get_all()) {
-        poly = Polynomial(circuit_size);
-    }
+    auto precomputed = PrecomputedEntities<Polynomial>::get_all();
+    parallel_for(precomputed.size(), [&](size_t i) { precomputed[i] = Polynomial(circuit_size); });
     // Allocate memory for witness polynomials
-    for (auto& poly : WitnessEntities<Polynomial>::get_all()) {
-        poly = Polynomial(circuit_size);
-    }
+    auto witness = WitnessEntities<Polynomial>::get_all();
+    parallel_for(witness.size(), [&](size_t i) { witness[i] = Polynomial(circuit_size); });
 };
 
 } // namespace bb
\ No newline at end of file
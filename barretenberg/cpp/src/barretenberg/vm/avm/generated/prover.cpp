@@ -62,8 +62,10 @@ void AvmProver::execute_wire_commitments_round()
     // logderivative phase)
     auto wire_polys = prover_polynomials.get_wires();
     auto labels = commitment_labels.get_wires();
+    // The wires mix empty, selector, small-range, sparse and dense columns, see CommitmentKey::batch_commit
+    auto commitments = commitment_key->batch_commit(wire_polys);
     for (size_t idx = 0; idx < wire_polys.size(); ++idx) {
-        transcript->send_to_verifier(labels[idx], commitment_key->commit_sparse(wire_polys[idx]));
+        transcript->send_to_verifier(labels[idx], commitments[idx]);
     }
 }
 
@@ -91,9 +93,9 @@ void AvmProver::execute_log_derivative_inverse_round()
 void AvmProver::execute_log_derivative_inverse_commitments_round()
 {
     // Commit to all logderivative inverse polynomials
-    for (auto [commitment, key_poly] : zip_view(witness_commitments.get_derived(), key->get_derived())) {
-        // We don't use commit_sparse here because the logderivative inverse polynomials are dense
-        commitment = commitment_key->commit(key_poly);
+    auto commitments = commitment_key->batch_commit(key->get_derived());
+    for (auto [commitment, computed] : zip_view(witness_commitments.get_derived(), commitments)) {
+        commitment = computed;
     }
 
     // Send all commitments to the verifier
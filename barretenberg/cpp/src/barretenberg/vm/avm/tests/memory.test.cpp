@@ -123,6 +123,41 @@ TEST_F(AvmMemoryTests, mismatchedTagEqOperation)
     validate_trace(std::move(trace), public_inputs);
 }
 
+// Testing memory operations on addresses spread over several pages and directories of the
+// simulated memory, written in descending address order. The memory trace must be sorted by
+// address and the proof must pass.
+TEST_F(AvmMemoryTests, addressesAcrossPages)
+{
+    std::vector<uint32_t> const addresses = { UINT32_MAX - 1, 1 << 22, 1 << 11, 1024, 1023, 0 };
+
+    for (size_t i = 0; i < addresses.size(); i++) {
+        trace_builder.op_set(0, i + 1, addresses[i], AvmMemoryTag::U32);
+    }
+    trace_builder.op_add(0, addresses[0], addresses[5], addresses[3], AvmMemoryTag::U32);
+    trace_builder.op_return(0, 0, 0);
+    auto trace = trace_builder.finalize();
+
+    // Find the addition and check the values loaded from both ends of the address range
+    auto row = std::ranges::find_if(trace.begin(), trace.end(), [](Row r) { return r.main_sel_op_add == FF(1); });
+    ASSERT_TRUE(row != trace.end());
+    EXPECT_EQ(row->main_ia, FF(1));
+    EXPECT_EQ(row->main_ib, FF(6));
+    EXPECT_EQ(row->main_ic, FF(7));
+
+    // Memory trace rows must appear in ascending address order
+    std::vector<FF> mem_addresses;
+    for (auto const& r : trace) {
+        if (r.mem_sel_mem == FF(1)) {
+            mem_addresses.push_back(r.mem_addr);
+        }
+    }
+    EXPECT_TRUE(std::ranges::is_sorted(mem_addresses, [](FF const& a, FF const& b) {
+        return static_cast<uint32_t>(a) < static_cast<uint32_t>(b);
+    }));
+
+    validate_trace(std::move(trace), public_inputs);
+}
+
 // Testing violation that m_lastAccess is a delimiter for two different addresses
 // in the memory trace
 TEST_F(AvmMemoryTests, mLastAccessViolation)
@@ -143,6 +143,8 @@ std::tuple<AvmFlavor::VerificationKey, HonkProof> Execution::prove(std::vector<u
     auto composer = AVM_TRACK_TIME_V("prove/create_composer", AvmComposer());
     auto prover = AVM_TRACK_TIME_V("prove/create_prover", composer.create_prover(circuit_builder));
     auto verifier = AVM_TRACK_TIME_V("prove/create_verifier", composer.create_verifier(circuit_builder));
+    // The row-major trace now lives in the proving key; release it before the (memory hungry) proof construction
+    circuit_builder.rows = {};
 
     vinfo("------- PROVING EXECUTION -------");
     // Proof structure: public_inputs | calldata_size | calldata | returndata_size | returndata | raw proof
@@ -13,19 +13,64 @@ namespace bb::avm_trace {
 void AvmMemTraceBuilder::reset()
 {
     mem_trace.clear();
+    mem_trace_next.clear();
     memory.fill({});
 }
 
 /**
  * @brief Prepare the memory trace to be incorporated into the main trace.
  *
- * @return The memory trace (which is moved).
+ * @details Every address keeps the chain of memory trace entries accessing it. These entries are appended in
+ *          execution order, i.e., by non-decreasing clk, and essentially only the sub-clk order within a clk may
+ *          differ from the append order. Walking the allocated pages in ascending (space_id, address) order and
+ *          concatenating the chains therefore yields the sorted trace, up to an insertion sort of each chain which
+ *          is linear on such nearly sorted input.
+ *
+ * @return The memory trace sorted by (space_id, address, clk, sub-clk).
  */
 std::vector<AvmMemTraceBuilder::MemoryTraceEntry> AvmMemTraceBuilder::finalize()
 {
-    // Sort avm_mem
-    std::sort(mem_trace.begin(), mem_trace.end());
-    return std::move(mem_trace);
+    std::vector<MemoryTraceEntry> sorted_mem_trace;
+    sorted_mem_trace.reserve(mem_trace.size());
+
+    for (auto& mem_space : memory) {
+        mem_space.for_each_cell([&](MemCell& cell) {
+            auto const chain_begin = sorted_mem_trace.size();
+            for (uint32_t idx = cell.first_trace_entry; idx != NO_MEM_TRACE_ENTRY; idx = mem_trace_next[idx]) {
+                sorted_mem_trace.push_back(std::move(mem_trace[idx]));
+            }
+            for (size_t i = chain_begin + 1; i < sorted_mem_trace.size(); i++) {
+                for (size_t j = i; j > chain_begin && sorted_mem_trace[j] < sorted_mem_trace[j - 1]; j--) {
+                    std::swap(sorted_mem_trace[j], sorted_mem_trace[j - 1]);
+                }
+            }
+            cell.first_trace_entry = NO_MEM_TRACE_ENTRY;
+            cell.last_trace_entry = NO_MEM_TRACE_ENTRY;
+        });
+    }
+    ASSERT(sorted_mem_trace.size() == mem_trace.size());
+
+    mem_trace.clear();
+    mem_trace_next.clear();
+    return sorted_mem_trace;
+}
+
+/**
+ * @brief Append an entry to the memory trace and link it to the chain of entries accessing the same address.
+ */
+void AvmMemTraceBuilder::append_to_mem_trace(MemoryTraceEntry const& entry)
+{
+    auto const idx = static_cast<uint32_t>(mem_trace.size());
+    auto& cell = memory.at(entry.m_space_id).get_or_create(entry.m_addr);
+    if (cell.last_trace_entry == NO_MEM_TRACE_ENTRY) {
+        cell.first_trace_entry = idx;
+    } else {
+        mem_trace_next[cell.last_trace_entry] = idx;
+    }
+    cell.last_trace_entry = idx;
+
+    mem_trace.emplace_back(entry);
+    mem_trace_next.push_back(NO_MEM_TRACE_ENTRY);
 }
 
 /**
@@ -72,7 +117,7 @@ void AvmMemTraceBuilder::insert_in_mem_trace(uint8_t space_id,
         mem_trace_entry.poseidon_mem_op = true;
         break;
     }
-    mem_trace.emplace_back(mem_trace_entry);
+    append_to_mem_trace(mem_trace_entry);
 }
 
 // Memory operations need to be performed before the addition of the corresponding row in
@@ -108,12 +153,15 @@ void AvmMemTraceBuilder::load_mismatch_tag_in_mem_trace(uint8_t space_id,
     // with m_tag_err enabled can be higher than one for a given clk value.
     // The repetition of the same clk in the lookup table side (right hand
     // side, here, memory table) should be accounted for ONLY ONCE.
-    bool tag_err_count_relevant = !m_tag_err_lookup_counts.contains(m_clk);
+    bool tag_err_count_relevant = tag_err_lookup_count(m_clk) == 0;
 
     // Lookup counter hint, used for #[INCL_MAIN_TAG_ERR] lookup (joined on clk)
+    if (m_clk >= m_tag_err_lookup_counts.size()) {
+        m_tag_err_lookup_counts.resize(static_cast<size_t>(m_clk) + 1, 0);
+    }
     m_tag_err_lookup_counts[m_clk]++;
 
-    mem_trace.emplace_back(MemoryTraceEntry{ .m_space_id = space_id,
+    append_to_mem_trace(MemoryTraceEntry{ .m_space_id = space_id,
                                              .m_clk = m_clk,
                                              .m_sub_clk = m_sub_clk,
                                              .m_addr = m_addr,
@@ -149,8 +197,7 @@ bool AvmMemTraceBuilder::load_from_mem_trace(uint8_t space_id,
                                              AvmMemoryTag w_in_tag,
                                              MemOpOwner mem_op_owner)
 {
-    auto& mem_space = memory.at(space_id);
-    AvmMemoryTag m_tag = mem_space.contains(addr) ? mem_space.at(addr).tag : AvmMemoryTag::U0;
+    AvmMemoryTag m_tag = read_in_simulated_mem_table(space_id, addr).tag;
 
     if (m_tag == AvmMemoryTag::U0 || m_tag == r_in_tag) {
         insert_in_mem_trace(space_id, clk, sub_clk, addr, val, m_tag, r_in_tag, w_in_tag, false, mem_op_owner);
@@ -220,10 +267,9 @@ AvmMemTraceBuilder::MemEntry AvmMemTraceBuilder::read_and_load_mov_opcode(uint8_
                                                                           uint32_t const clk,
                                                                           uint32_t const addr)
 {
-    auto& mem_space = memory.at(space_id);
-    MemEntry mem_entry = mem_space.contains(addr) ? mem_space.at(addr) : MemEntry{};
+    MemEntry mem_entry = read_in_simulated_mem_table(space_id, addr);
 
-    mem_trace.emplace_back(MemoryTraceEntry{
+    append_to_mem_trace(MemoryTraceEntry{
         .m_space_id = space_id,
         .m_clk = clk,
         .m_sub_clk = SUB_CLK_LOAD_A,
@@ -257,16 +303,15 @@ AvmMemTraceBuilder::MemEntry AvmMemTraceBuilder::read_and_load_mov_opcode(uint8_
 std::array<AvmMemTraceBuilder::MemEntry, 3> AvmMemTraceBuilder::read_and_load_cmov_opcode(
     uint8_t space_id, uint32_t clk, uint32_t a_addr, uint32_t b_addr, uint32_t cond_addr)
 {
-    auto& mem_space = memory.at(space_id);
-    MemEntry a_mem_entry = mem_space.contains(a_addr) ? mem_space.at(a_addr) : MemEntry{};
-    MemEntry b_mem_entry = mem_space.contains(b_addr) ? mem_space.at(b_addr) : MemEntry{};
-    MemEntry cond_mem_entry = mem_space.contains(cond_addr) ? mem_space.at(cond_addr) : MemEntry{};
+    MemEntry a_mem_entry = read_in_simulated_mem_table(space_id, a_addr);
+    MemEntry b_mem_entry = read_in_simulated_mem_table(space_id, b_addr);
+    MemEntry cond_mem_entry = read_in_simulated_mem_table(space_id, cond_addr);
 
     bool mov_b = cond_mem_entry.val == 0;
 
     AvmMemoryTag r_w_in_tag = mov_b ? b_mem_entry.tag : a_mem_entry.tag;
 
-    mem_trace.emplace_back(MemoryTraceEntry{
+    append_to_mem_trace(MemoryTraceEntry{
         .m_space_id = space_id,
         .m_clk = clk,
         .m_sub_clk = SUB_CLK_LOAD_A,
@@ -279,7 +324,7 @@ std::array<AvmMemTraceBuilder::MemEntry, 3> AvmMemTraceBuilder::read_and_load_cm
         .m_sel_cmov = true,
     });
 
-    mem_trace.emplace_back(MemoryTraceEntry{
+    append_to_mem_trace(MemoryTraceEntry{
         .m_space_id = space_id,
         .m_clk = clk,
         .m_sub_clk = SUB_CLK_LOAD_B,
@@ -292,7 +337,7 @@ std::array<AvmMemTraceBuilder::MemEntry, 3> AvmMemTraceBuilder::read_and_load_cm
         .m_sel_cmov = true,
     });
 
-    mem_trace.emplace_back(MemoryTraceEntry{
+    append_to_mem_trace(MemoryTraceEntry{
         .m_space_id = space_id,
         .m_clk = clk,
         .m_sub_clk = SUB_CLK_LOAD_D,
@@ -323,10 +368,9 @@ AvmMemTraceBuilder::MemEntry AvmMemTraceBuilder::read_and_load_jumpi_opcode(uint
                                                                             uint32_t clk,
                                                                             uint32_t cond_addr)
 {
-    auto& mem_space = memory.at(space_id);
-    MemEntry cond_mem_entry = mem_space.contains(cond_addr) ? mem_space.at(cond_addr) : MemEntry{};
+    MemEntry cond_mem_entry = read_in_simulated_mem_table(space_id, cond_addr);
 
-    mem_trace.emplace_back(MemoryTraceEntry{
+    append_to_mem_trace(MemoryTraceEntry{
         .m_space_id = space_id,
         .m_clk = clk,
         .m_sub_clk = SUB_CLK_LOAD_D,
@@ -360,10 +404,9 @@ AvmMemTraceBuilder::MemEntry AvmMemTraceBuilder::read_and_load_cast_opcode(uint8
                                                                            uint32_t addr,
                                                                            AvmMemoryTag w_in_tag)
 {
-    auto& mem_space = memory.at(space_id);
-    MemEntry mem_entry = mem_space.contains(addr) ? mem_space.at(addr) : MemEntry{};
+    MemEntry mem_entry = read_in_simulated_mem_table(space_id, addr);
 
-    mem_trace.emplace_back(MemoryTraceEntry{
+    append_to_mem_trace(MemoryTraceEntry{
         .m_space_id = space_id,
         .m_clk = clk,
         .m_sub_clk = SUB_CLK_LOAD_A,
@@ -415,8 +458,7 @@ AvmMemTraceBuilder::MemRead AvmMemTraceBuilder::read_and_load_from_memory(uint8_
         sub_clk = SUB_CLK_LOAD_D;
         break;
     }
-    auto& mem_space = memory.at(space_id);
-    FF val = mem_space.contains(addr) ? mem_space.at(addr).val : 0;
+    FF val = read_in_simulated_mem_table(space_id, addr).val;
     bool tagMatch = load_from_mem_trace(space_id, clk, sub_clk, addr, val, r_in_tag, w_in_tag, mem_op_owner);
 
     return MemRead{
@@ -446,8 +488,7 @@ AvmMemTraceBuilder::MemRead AvmMemTraceBuilder::indirect_read_and_load_from_memo
         break;
     }
 
-    auto& mem_space = memory.at(space_id);
-    FF val = mem_space.contains(addr) ? mem_space.at(addr).val : 0;
+    FF val = read_in_simulated_mem_table(space_id, addr).val;
     bool tagMatch = load_from_mem_trace(space_id, clk, sub_clk, addr, val, AvmMemoryTag::U32, AvmMemoryTag::U0);
 
     return MemRead{
@@ -514,9 +555,7 @@ std::vector<FF> AvmMemTraceBuilder::read_return_opcode(uint32_t clk,
     std::vector<FF> returndata;
     for (uint32_t i = 0; i < ret_size; i++) {
         auto addr = direct_ret_offset + i;
-        auto& mem_space = memory.at(space_id);
-        FF val = mem_space.contains(addr) ? mem_space.at(addr).val : 0;
-        AvmMemoryTag tag = mem_space.contains(addr) ? mem_space.at(addr).tag : AvmMemoryTag::U0;
+        auto const [val, tag] = read_in_simulated_mem_table(space_id, addr);
 
         // No tag checking is performed for RETURN opcode.
         insert_in_mem_trace(space_id,
@@ -566,19 +605,53 @@ bool AvmMemTraceBuilder::MemoryTraceEntry::operator<(const AvmMemTraceBuilder::M
     return m_sub_clk < other.m_sub_clk;
 }
 
+AvmMemTraceBuilder::MemEntry AvmMemTraceBuilder::read_in_simulated_mem_table(uint8_t space_id, uint32_t addr) const
+{
+    MemCell const* cell = memory.at(space_id).find(addr);
+    return cell != nullptr ? cell->entry : MemEntry{};
+}
+
 void AvmMemTraceBuilder::write_in_simulated_mem_table(uint8_t space_id,
                                                       uint32_t addr,
                                                       FF const& val,
                                                       AvmMemoryTag w_in_tag)
 {
-    MemEntry memEntry{ val, w_in_tag };
-    auto& mem_space = memory.at(space_id);
-    auto it = mem_space.find(addr);
-    if (it != mem_space.end()) {
-        it->second = memEntry;
-    } else {
-        mem_space.emplace(addr, memEntry);
+    memory.at(space_id).get_or_create(addr).entry = MemEntry{ val, w_in_tag };
+}
+
+/**
+ * @brief Return the cell at the supplied address, or nullptr if its page has not been allocated.
+ */
+AvmMemTraceBuilder::MemCell const* AvmMemTraceBuilder::MemSpace::find(uint32_t addr) const
+{
+    auto const dir_idx = addr >> (MEM_DIRECTORY_BITS + MEM_PAGE_BITS);
+    auto const page_idx = (addr >> MEM_PAGE_BITS) & ((1U << MEM_DIRECTORY_BITS) - 1);
+    if (dir_idx >= directories.size() || page_idx >= directories[dir_idx].size()) {
+        return nullptr;
+    }
+    auto const& page = directories[dir_idx][page_idx];
+    return page.empty() ? nullptr : &page[addr & ((1U << MEM_PAGE_BITS) - 1)];
+}
+
+/**
+ * @brief Return the cell at the supplied address, allocating its directory and page if needed.
+ */
+AvmMemTraceBuilder::MemCell& AvmMemTraceBuilder::MemSpace::get_or_create(uint32_t addr)
+{
+    auto const dir_idx = addr >> (MEM_DIRECTORY_BITS + MEM_PAGE_BITS);
+    auto const page_idx = (addr >> MEM_PAGE_BITS) & ((1U << MEM_DIRECTORY_BITS) - 1);
+    if (dir_idx >= directories.size()) {
+        directories.resize(static_cast<size_t>(dir_idx) + 1);
+    }
+    auto& directory = directories[dir_idx];
+    if (page_idx >= directory.size()) {
+        directory.resize(static_cast<size_t>(page_idx) + 1);
+    }
+    auto& page = directory[page_idx];
+    if (page.empty()) {
+        page.resize(1U << MEM_PAGE_BITS);
     }
+    return page[addr & ((1U << MEM_PAGE_BITS) - 1)];
 }
 
 } // namespace bb::avm_trace
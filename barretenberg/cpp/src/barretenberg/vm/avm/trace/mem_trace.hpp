@@ -3,6 +3,7 @@
 #include "barretenberg/vm/avm/trace/common.hpp"
 
 #include <cstdint>
+#include <vector>
 
 namespace bb::avm_trace {
 
@@ -23,9 +24,14 @@ class AvmMemTraceBuilder {
     static const uint32_t SUB_CLK_STORE_D = 11;
     static const uint32_t NUM_SUB_CLK = 12;
 
+    // Number of bits of an address which index a cell within a page of the simulated memory
+    static const uint32_t MEM_PAGE_BITS = 10;
+    // Number of bits of an address which index a page within a directory of the simulated memory
+    static const uint32_t MEM_DIRECTORY_BITS = 11;
+
     // Keeps track of the number of times a mem tag err should appear in the trace
-    // clk -> count
-    std::map<uint32_t, uint32_t> m_tag_err_lookup_counts;
+    // clk -> count (indexed by clk, zero for any clk without a tag error)
+    std::vector<uint32_t> m_tag_err_lookup_counts;
 
     struct MemoryTraceEntry {
         uint8_t m_space_id = 0;
@@ -60,6 +66,49 @@ class AvmMemTraceBuilder {
         AvmMemoryTag tag = AvmMemoryTag::U0;
     };
 
+    // Sentinel for "no memory trace entry" in the per-address chains of memory trace entries.
+    static const uint32_t NO_MEM_TRACE_ENTRY = UINT32_MAX;
+
+    // A cell of the simulated memory together with the chain of memory trace entries accessing it.
+    struct MemCell {
+        MemEntry entry{};
+        uint32_t first_trace_entry = NO_MEM_TRACE_ENTRY;
+        uint32_t last_trace_entry = NO_MEM_TRACE_ENTRY;
+    };
+
+    /**
+     * @brief A single 32-bit address space of the simulated memory, stored as a two-level table of lazily allocated
+     *        pages of cells.
+     * @details An address is split into (directory, page, cell) indices, so a load or a store costs two indexed
+     *          loads instead of a hash probe. Directories and pages are only allocated the first time one of their
+     *          cells is written to or accessed from the memory trace; reading an untouched cell allocates nothing.
+     */
+    class MemSpace {
+      public:
+        MemCell const* find(uint32_t addr) const;
+        MemCell& get_or_create(uint32_t addr);
+
+        /**
+         * @brief Invoke func(cell) on every cell of every allocated page, in ascending address order.
+         */
+        template <typename Func> void for_each_cell(Func&& func)
+        {
+            for (auto& directory : directories) {
+                for (auto& page : directory) {
+                    for (auto& cell : page) {
+                        func(cell);
+                    }
+                }
+            }
+        }
+
+      private:
+        // An empty page (resp. directory) has not been allocated yet.
+        using Page = std::vector<MemCell>;
+        using Directory = std::vector<Page>;
+        std::vector<Directory> directories;
+    };
+
     // Structure to return value and tag matching boolean after a memory read.
     struct MemRead {
         bool tag_match = false;
@@ -79,6 +128,11 @@ class AvmMemTraceBuilder {
 
     std::vector<MemoryTraceEntry> finalize();
 
+    uint32_t tag_err_lookup_count(uint32_t clk) const
+    {
+        return clk < m_tag_err_lookup_counts.size() ? m_tag_err_lookup_counts[clk] : 0;
+    }
+
     MemEntry read_and_load_mov_opcode(uint8_t space_id, uint32_t clk, uint32_t addr);
     std::array<MemEntry, 3> read_and_load_cmov_opcode(
         uint8_t space_id, uint32_t clk, uint32_t a_addr, uint32_t b_addr, uint32_t cond_addr);
@@ -109,13 +163,18 @@ class AvmMemTraceBuilder {
     std::vector<FF> read_return_opcode(uint32_t clk, uint8_t space_id, uint32_t direct_ret_offset, uint32_t ret_size);
 
     // DO NOT USE FOR REAL OPERATIONS
-    FF unconstrained_read(uint8_t space_id, uint32_t addr) { return memory[space_id][addr].val; }
+    FF unconstrained_read(uint8_t space_id, uint32_t addr) { return read_in_simulated_mem_table(space_id, addr).val; }
 
   private:
-    std::vector<MemoryTraceEntry> mem_trace; // Entries will be sorted by m_clk, m_sub_clk after finalize().
+    // Entries are appended in execution order and are sorted by (m_space_id, m_addr, m_clk, m_sub_clk) in finalize().
+    std::vector<MemoryTraceEntry> mem_trace;
+    // For each entry of mem_trace, the index of the next entry accessing the same address (or NO_MEM_TRACE_ENTRY).
+    std::vector<uint32_t> mem_trace_next;
+
+    // Global Memory table (used for simulation), one paged address space per space_id
+    std::array<MemSpace, NUM_MEM_SPACES> memory;
 
-    // Global Memory table (used for simulation): (space_id, (address, mem_entry))
-    std::array<std::unordered_map<uint32_t, MemEntry>, NUM_MEM_SPACES> memory;
+    void append_to_mem_trace(MemoryTraceEntry const& entry);
 
     void insert_in_mem_trace(uint8_t space_id,
                              uint32_t m_clk,
@@ -153,6 +212,7 @@ class AvmMemTraceBuilder {
                             AvmMemoryTag r_in_tag,
                             AvmMemoryTag w_in_tag,
                             MemOpOwner mem_op_owner = MAIN);
+    MemEntry read_in_simulated_mem_table(uint8_t space_id, uint32_t addr) const;
     void write_in_simulated_mem_table(uint8_t space_id, uint32_t addr, FF const& val, AvmMemoryTag w_in_tag);
 };
 } // namespace bb::avm_trace
@@ -14,6 +14,7 @@
 #include <vector>
 
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
@@ -74,8 +75,11 @@ uint32_t finalize_rng_chks_for_testing(std::vector<Row>& main_trace,
         }
     }
 
-    for (auto const& [clk, count] : mem_trace_builder.m_tag_err_lookup_counts) {
-        custom_clk.insert(clk);
+    auto const& tag_err_lookup_counts = mem_trace_builder.m_tag_err_lookup_counts;
+    for (uint32_t clk = 0; clk < tag_err_lookup_counts.size(); clk++) {
+        if (tag_err_lookup_counts[clk] != 0) {
+            custom_clk.insert(clk);
+        }
     }
 
     auto old_size = main_trace.size();
@@ -257,8 +261,11 @@ void AvmTraceBuilder::write_slice_to_memory(AddressWithMode addr, AvmMemoryTag w
 // NOTE: its coupled to pil - this is not the final iteration
 void AvmTraceBuilder::finalise_mem_trace_lookup_counts()
 {
-    for (auto const& [clk, count] : mem_trace_builder.m_tag_err_lookup_counts) {
-        main_trace.at(clk).incl_main_tag_err_counts = count;
+    auto const& tag_err_lookup_counts = mem_trace_builder.m_tag_err_lookup_counts;
+    for (uint32_t clk = 0; clk < tag_err_lookup_counts.size(); clk++) {
+        if (tag_err_lookup_counts[clk] != 0) {
+            main_trace.at(clk).incl_main_tag_err_counts = tag_err_lookup_counts[clk];
+        }
     }
 }
 
@@ -3393,13 +3400,40 @@ void AvmTraceBuilder::op_keccakf1600(uint8_t indirect,
  */
 std::vector<Row> AvmTraceBuilder::finalize(bool range_check_required)
 {
-    auto mem_trace = mem_trace_builder.finalize();
-    auto conv_trace = conversion_trace_builder.finalize();
-    auto sha256_trace = sha256_trace_builder.finalize();
-    auto poseidon2_trace = poseidon2_trace_builder.finalize();
-    auto keccak_trace = keccak_trace_builder.finalize();
-    auto pedersen_trace = pedersen_trace_builder.finalize();
-    auto slice_trace = slice_trace_builder.finalize();
+    // The sub-trace builders are independent of each other until they are merged into the main trace, so finalize
+    // them concurrently.
+    std::vector<AvmMemTraceBuilder::MemoryTraceEntry> mem_trace;
+    std::vector<AvmConversionTraceBuilder::ConversionTraceEntry> conv_trace;
+    std::vector<AvmSha256TraceBuilder::Sha256TraceEntry> sha256_trace;
+    std::vector<AvmPoseidon2TraceBuilder::Poseidon2TraceEntry> poseidon2_trace;
+    std::vector<AvmKeccakTraceBuilder::KeccakTraceEntry> keccak_trace;
+    std::vector<AvmPedersenTraceBuilder::PedersenTraceEntry> pedersen_trace;
+    std::vector<AvmSliceTraceBuilder::SliceTraceEntry> slice_trace;
+    std::vector<AvmCmpBuilder::CmpRow> cmp_trace_canonical;
+    auto cmp_trace_size = alu_trace_builder.cmp_builder.get_cmp_trace_size();
+
+    std::vector<std::function<void()>> finalize_tasks = {
+        [&]() { AVM_TRACK_TIME("prove/gen_trace/finalize/mem", (mem_trace = mem_trace_builder.finalize())); },
+        [&]() { AVM_TRACK_TIME("prove/gen_trace/finalize/conv", (conv_trace = conversion_trace_builder.finalize())); },
+        [&]() { AVM_TRACK_TIME("prove/gen_trace/finalize/sha256", (sha256_trace = sha256_trace_builder.finalize())); },
+        [&]() {
+            AVM_TRACK_TIME("prove/gen_trace/finalize/poseidon2",
+                           (poseidon2_trace = poseidon2_trace_builder.finalize()));
+        },
+        [&]() { AVM_TRACK_TIME("prove/gen_trace/finalize/keccak", (keccak_trace = keccak_trace_builder.finalize())); },
+        [&]() {
+            AVM_TRACK_TIME("prove/gen_trace/finalize/pedersen", (pedersen_trace = pedersen_trace_builder.finalize()));
+        },
+        [&]() { AVM_TRACK_TIME("prove/gen_trace/finalize/slice", (slice_trace = slice_trace_builder.finalize())); },
+        // The cmp gadget only records range checks into its own range check builder
+        [&]() {
+            AVM_TRACK_TIME("prove/gen_trace/finalize/cmp",
+                           (cmp_trace_canonical = alu_trace_builder.cmp_builder.into_canonical(
+                                alu_trace_builder.cmp_builder.finalize())));
+        },
+    };
+    bb::parallel_for(finalize_tasks.size(), [&](size_t i) { finalize_tasks[i](); });
+
     const auto& fixed_gas_table = FixedGasTable::get();
     size_t mem_trace_size = mem_trace.size();
     size_t main_trace_size = main_trace.size();
@@ -3420,7 +3454,7 @@ std::vector<Row> AvmTraceBuilder::finalize(bool range_check_required)
                                         range_check_size,     conv_trace_size,       sha256_trace_size,
                                         poseidon2_trace_size, pedersen_trace_size,   gas_trace_size + 1,
                                         KERNEL_INPUTS_LENGTH, KERNEL_OUTPUTS_LENGTH, fixed_gas_table.size(),
-                                        slice_trace_size,     calldata.size() };
+                                        slice_trace_size,     calldata.size(),       cmp_trace_size };
     auto trace_size = std::max_element(trace_sizes.begin(), trace_sizes.end());
 
     // Before making any changes to the main trace, mark the real rows.
@@ -3433,28 +3467,38 @@ std::vector<Row> AvmTraceBuilder::finalize(bool range_check_required)
     // We only need to pad with zeroes to the size to the largest trace here,
     // pow_2 padding is handled in the subgroup_size check in BB.
     // Resize the main_trace to accomodate a potential lookup, filling with default empty rows.
+    // The main trace is never resized again before the first row is inserted, so the merges below can write into it
+    // concurrently.
     main_trace_size = *trace_size;
     size_t main_trace_size_pre_padding = main_trace.size();
     main_trace.resize(*trace_size);
 
     /**********************************************************************************************
-     * MEMORY TRACE INCLUSION
+     * GADGET TRACES INCLUSION
      **********************************************************************************************/
 
-    // We compute in the main loop the timestamp and global address for next row.
-    // Perform initialization for index 0 outside of the loop provided that mem trace exists.
-    if (mem_trace_size > 0) {
-        main_trace.at(0).mem_tsp =
-            FF(AvmMemTraceBuilder::NUM_SUB_CLK * mem_trace.at(0).m_clk + mem_trace.at(0).m_sub_clk);
-
-        main_trace.at(0).mem_glob_addr =
-            FF(mem_trace.at(0).m_addr + (static_cast<uint64_t>(mem_trace.at(0).m_space_id) << 32));
-    }
+    // Every gadget trace is placed at the top of the main trace and writes its own set of columns, so the merge is a
+    // scatter over disjoint rows and columns which is done in parallel over chunks of rows.
+    auto mem_tsp = [](const AvmMemTraceBuilder::MemoryTraceEntry& entry) {
+        return FF(AvmMemTraceBuilder::NUM_SUB_CLK * entry.m_clk + entry.m_sub_clk);
+    };
+    auto mem_glob_addr = [](const AvmMemTraceBuilder::MemoryTraceEntry& entry) {
+        return FF(entry.m_addr + (static_cast<uint64_t>(entry.m_space_id) << 32));
+    };
+    // Difference between the memory row i and the next one, which is range checked
+    auto mem_diff = [&](size_t i) {
+        const auto& curr = mem_trace.at(i);
+        const auto& next = mem_trace.at(i + 1);
+        return mem_glob_addr(next) == mem_glob_addr(curr) ? mem_tsp(next) - mem_tsp(curr)
+                                                          : mem_glob_addr(next) - mem_glob_addr(curr);
+    };
 
-    for (size_t i = 0; i < mem_trace_size; i++) {
+    auto merge_mem_row = [&](size_t i) {
         auto const& src = mem_trace.at(i);
         auto& dest = main_trace.at(i);
 
+        dest.mem_tsp = mem_tsp(src);
+        dest.mem_glob_addr = mem_glob_addr(src);
         dest.mem_sel_mem = FF(1);
         dest.mem_clk = FF(src.m_clk);
         dest.mem_addr = FF(src.m_addr);
@@ -3526,123 +3570,110 @@ std::vector<Row> AvmTraceBuilder::finalize(bool range_check_required)
         }
 
         if (i + 1 < mem_trace_size) {
-            auto const& next = mem_trace.at(i + 1);
-            auto& dest_next = main_trace.at(i + 1);
-            dest_next.mem_tsp = FF(AvmMemTraceBuilder::NUM_SUB_CLK * next.m_clk + next.m_sub_clk);
-            dest_next.mem_glob_addr = FF(next.m_addr + (static_cast<uint64_t>(next.m_space_id) << 32));
-
-            FF diff{};
-            if (dest_next.mem_glob_addr == dest.mem_glob_addr) {
-                diff = dest_next.mem_tsp - dest.mem_tsp;
-            } else {
-                diff = dest_next.mem_glob_addr - dest.mem_glob_addr;
+            if (mem_glob_addr(mem_trace.at(i + 1)) != dest.mem_glob_addr) {
                 dest.mem_lastAccess = FF(1);
             }
             dest.mem_sel_rng_chk = FF(1);
-
             // Decomposition of diff
-            dest.mem_diff = uint64_t(diff);
-            // It's not great that this happens here, but we can clean it up after we extract the range checks
-            // Mem Address row differences are range checked to 40 bits, and the inter-trace index is the timestamp
-            range_check_builder.assert_range(uint128_t(diff), 40, EventEmitter::MEMORY, uint64_t(dest.mem_tsp));
-
+            dest.mem_diff = uint64_t(mem_diff(i));
         } else {
             dest.mem_lastAccess = FF(1);
             dest.mem_last = FF(1);
         }
-    }
+    };
 
-    /**********************************************************************************************
-     * ALU TRACE INCLUSION
-     **********************************************************************************************/
-    // Finalize cmp gadget of the ALU trace
-    auto cmp_trace_size = alu_trace_builder.cmp_builder.get_cmp_trace_size();
-    // HERE IS THE SEG FAULT BUG
-    if (main_trace_size < cmp_trace_size) {
-        main_trace_size = cmp_trace_size;
-        main_trace.resize(cmp_trace_size, {});
-    }
-    std::vector<AvmCmpBuilder::CmpEntry> cmp_trace = alu_trace_builder.cmp_builder.finalize();
-    auto cmp_trace_canonical = alu_trace_builder.cmp_builder.into_canonical(cmp_trace);
-    for (size_t i = 0; i < cmp_trace_canonical.size(); i++) {
-        alu_trace_builder.cmp_builder.merge_into(main_trace.at(i), cmp_trace_canonical.at(i));
-    }
+    auto merge_gadget_rows = [&](size_t start, size_t end) {
+        for (size_t i = start; i < std::min(end, mem_trace_size); i++) {
+            merge_mem_row(i);
+        }
 
-    alu_trace_builder.finalize(main_trace);
+        // Cmp gadget of the ALU trace
+        for (size_t i = start; i < std::min(end, cmp_trace_canonical.size()); i++) {
+            alu_trace_builder.cmp_builder.merge_into(main_trace.at(i), cmp_trace_canonical.at(i));
+        }
 
-    /**********************************************************************************************
-     * GADGET TABLES INCLUSION
-     **********************************************************************************************/
+        // Conversion Gadget table
+        for (size_t i = start; i < std::min(end, conv_trace_size); i++) {
+            auto const& src = conv_trace.at(i);
+            auto& dest = main_trace.at(i);
+            dest.conversion_sel_to_radix_le = FF(static_cast<uint8_t>(src.to_radix_le_sel));
+            dest.conversion_clk = FF(src.conversion_clk);
+            dest.conversion_input = src.input;
+            dest.conversion_radix = FF(src.radix);
+            dest.conversion_num_limbs = FF(src.num_limbs);
+        }
 
-    // Add Conversion Gadget table
-    for (size_t i = 0; i < conv_trace_size; i++) {
-        auto const& src = conv_trace.at(i);
-        auto& dest = main_trace.at(i);
-        dest.conversion_sel_to_radix_le = FF(static_cast<uint8_t>(src.to_radix_le_sel));
-        dest.conversion_clk = FF(src.conversion_clk);
-        dest.conversion_input = src.input;
-        dest.conversion_radix = FF(src.radix);
-        dest.conversion_num_limbs = FF(src.num_limbs);
-    }
+        // SHA256 Gadget table
+        for (size_t i = start; i < std::min(end, sha256_trace_size); i++) {
+            auto const& src = sha256_trace.at(i);
+            auto& dest = main_trace.at(i);
+            dest.sha256_clk = FF(src.clk);
+            dest.sha256_input = src.input[0];
+            // TODO: This will need to be enabled later
+            // dest.sha256_output = src.output[0];
+            dest.sha256_sel_sha256_compression = FF(1);
+            dest.sha256_state = src.state[0];
+        }
 
-    // Add SHA256 Gadget table
-    for (size_t i = 0; i < sha256_trace_size; i++) {
-        auto const& src = sha256_trace.at(i);
-        auto& dest = main_trace.at(i);
-        dest.sha256_clk = FF(src.clk);
-        dest.sha256_input = src.input[0];
-        // TODO: This will need to be enabled later
-        // dest.sha256_output = src.output[0];
-        dest.sha256_sel_sha256_compression = FF(1);
-        dest.sha256_state = src.state[0];
-    }
+        // Poseidon2 Gadget table
+        for (size_t i = start; i < std::min(end, poseidon2_trace_size); i++) {
+            auto& dest = main_trace.at(i);
+            auto const& src = poseidon2_trace.at(i);
+            dest.poseidon2_clk = FF(src.clk);
+            merge_into(dest, src);
+        }
 
-    // Add Poseidon2 Gadget table
-    for (size_t i = 0; i < poseidon2_trace_size; i++) {
-        auto& dest = main_trace.at(i);
-        auto const& src = poseidon2_trace.at(i);
-        dest.poseidon2_clk = FF(src.clk);
-        merge_into(dest, src);
-    }
+        // KeccakF1600 Gadget table
+        for (size_t i = start; i < std::min(end, keccak_trace_size); i++) {
+            auto const& src = keccak_trace.at(i);
+            auto& dest = main_trace.at(i);
+            dest.keccakf1600_clk = FF(src.clk);
+            dest.keccakf1600_input = FF(src.input[0]);
+            // TODO: This will need to be enabled later
+            // dest.keccakf1600_output = src.output[0];
+            dest.keccakf1600_sel_keccakf1600 = FF(1);
+        }
 
-    // Add KeccakF1600 Gadget table
-    for (size_t i = 0; i < keccak_trace_size; i++) {
-        auto const& src = keccak_trace.at(i);
-        auto& dest = main_trace.at(i);
-        dest.keccakf1600_clk = FF(src.clk);
-        dest.keccakf1600_input = FF(src.input[0]);
-        // TODO: This will need to be enabled later
-        // dest.keccakf1600_output = src.output[0];
-        dest.keccakf1600_sel_keccakf1600 = FF(1);
-    }
+        // Pedersen Gadget table
+        for (size_t i = start; i < std::min(end, pedersen_trace_size); i++) {
+            auto const& src = pedersen_trace.at(i);
+            auto& dest = main_trace.at(i);
+            dest.pedersen_clk = FF(src.clk);
+            dest.pedersen_input = FF(src.input[0]);
+            dest.pedersen_sel_pedersen = FF(1);
+        }
 
-    // Add Pedersen Gadget table
-    for (size_t i = 0; i < pedersen_trace_size; i++) {
-        auto const& src = pedersen_trace.at(i);
-        auto& dest = main_trace.at(i);
-        dest.pedersen_clk = FF(src.clk);
-        dest.pedersen_input = FF(src.input[0]);
-        dest.pedersen_sel_pedersen = FF(1);
-    }
+        // Slice trace
+        for (size_t i = start; i < std::min(end, slice_trace_size); i++) {
+            merge_into(main_trace.at(i), slice_trace.at(i));
+        }
+    };
+    AVM_TRACK_TIME("prove/gen_trace/finalize/merge_gadgets",
+                   bb::parallel_for_range(main_trace_size, merge_gadget_rows));
 
-    /**********************************************************************************************
-     * SLICE TRACE INCLUSION
-     **********************************************************************************************/
-    for (size_t i = 0; i < slice_trace_size; i++) {
-        merge_into(main_trace.at(i), slice_trace.at(i));
+    // The range checks are recorded serially, in row order, as the range check builder is not thread safe.
+    // It's not great that this happens here, but we can clean it up after we extract the range checks
+    // Mem Address row differences are range checked to 40 bits, and the inter-trace index is the timestamp
+    for (size_t i = 0; i + 1 < mem_trace_size; i++) {
+        range_check_builder.assert_range(
+            uint128_t(mem_diff(i)), 40, EventEmitter::MEMORY, uint64_t(mem_tsp(mem_trace.at(i))));
     }
 
     /**********************************************************************************************
-     * BINARY TRACE INCLUSION
+     * ALU, BINARY, GAS AND KERNEL TRACES INCLUSION
      **********************************************************************************************/
 
-    bin_trace_builder.finalize(main_trace);
-
-    /**********************************************************************************************
-     * GAS TRACE INCLUSION
-     **********************************************************************************************/
+    // These builders fill their columns with a sequential pass over the main trace, but they write disjoint sets of
+    // columns (and the gas and kernel builders only read execution columns that no builder writes), so they run
+    // concurrently.
+    std::vector<std::function<void()>> merge_tasks = {
+        [&]() { AVM_TRACK_TIME("prove/gen_trace/finalize/alu", alu_trace_builder.finalize(main_trace)); },
+        [&]() { AVM_TRACK_TIME("prove/gen_trace/finalize/binary", bin_trace_builder.finalize(main_trace)); },
+        [&]() { AVM_TRACK_TIME("prove/gen_trace/finalize/gas", gas_trace_builder.finalize(main_trace)); },
+        [&]() { AVM_TRACK_TIME("prove/gen_trace/finalize/kernel", kernel_trace_builder.finalize(main_trace)); },
+    };
+    bb::parallel_for(merge_tasks.size(), [&](size_t i) { merge_tasks[i](); });
 
-    gas_trace_builder.finalize(main_trace);
     // We need to assert here instead of finalize until we figure out inter-trace threading
     for (size_t i = 0; i < gas_trace_size; i++) {
         auto& dest = main_trace.at(i);
@@ -3652,12 +3683,6 @@ std::vector<Row> AvmTraceBuilder::finalize(bool range_check_required)
             uint128_t(dest.main_abs_da_rem_gas), 32, EventEmitter::GAS_DA, uint64_t(dest.main_clk));
     }
 
-    /**********************************************************************************************
-     * KERNEL TRACE INCLUSION
-     **********************************************************************************************/
-
-    kernel_trace_builder.finalize(main_trace);
-
     /**********************************************************************************************
      * ONLY FIXED TABLES FROM HERE ON
      **********************************************************************************************/
@@ -3715,7 +3740,7 @@ std::vector<Row> AvmTraceBuilder::finalize(bool range_check_required)
 
         r.main_clk = i >= old_trace_size ? r.main_clk : FF(i);
         auto counter = i >= old_trace_size ? static_cast<uint32_t>(r.main_clk) : static_cast<uint32_t>(i);
-        r.incl_main_tag_err_counts = mem_trace_builder.m_tag_err_lookup_counts[static_cast<uint32_t>(counter)];
+        r.incl_main_tag_err_counts = mem_trace_builder.tag_err_lookup_count(counter);
 
         if (counter <= UINT8_MAX) {
             auto counter_u8 = static_cast<uint8_t>(counter);